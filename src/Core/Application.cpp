@@ -1,44 +1,234 @@
 #include "Application.hpp"
 
+#include "FlightRecorder.hpp"
+#include "Gamepad.hpp"
 #include "Input.hpp"
+#include "Task.hpp"
+#include "Metrics/Metrics.hpp"
+#include "Renderer/Present.hpp"
 
 namespace Core {
 
-    Application::Application()
+    Application::Application(const Config& config)
+        : m_ProfilerConfig(config.profiler)
     {
+        Threading::Topology::Configure(config.threading);
+        Threading::Topology::AddStartHook(&SamplingProfiler::RegisterThread);
+        Threading::Topology::AddStartHook(&FlightRecorder::InstallAlternateStack);
+        Threading::Topology::Apply(Threading::ThreadRole::Main, "Main");
+
+        EventInterest::Add(EventMaskOf<WindowClosedEvent, WindowMinimizeEvent>);
+
+        FlightRecorder::Install();
+        Metrics::Registry::Init();
+        PerfCounters::Init(config.perfCounters);
+        HitchWatchdog::Start(config.watchdog);
+
         m_Timer = std::make_unique<Timer>();
+        DeferredWork::Init(config.deferredWork);
 
         m_EventQueue = std::make_unique<EventQueue<CoreEvents>>();
 
         m_Window = std::make_shared<Window>(Window::Config(1280, 720, "Renderer"));
         m_Window->BindEventQueue(m_EventQueue.get());
+        m_Window->BindEventChannel(&s_EventChannel);
+
+        m_World = std::make_unique<ECS::World>();
+
+        Renderer::SoftwareRenderer::Config rendererConfig;
+        rendererConfig.width = m_Window->GetWidth();
+        rendererConfig.height = m_Window->GetHeight();
+        m_Renderer = std::make_unique<Renderer::SoftwareRenderer>(rendererConfig);
 
         Input::Init();
+        Gamepad::Init(m_EventQueue.get());
+        IO::Init(m_EventQueue.get(), config.io);
+        EventInjector::Init(m_EventQueue.get(), config.injection);
+
+        m_QuitAction = InputActions::GetAction("Quit");
+        m_ScreenshotAction = InputActions::GetAction("Screenshot");
+        m_ProfilerAction = InputActions::GetAction("ToggleProfiler");
+        InputActions::Load(ActionBindings()
+            .BindAction("Quit", InputBinding::Key(KeyCode::Escape))
+            .BindAction("Screenshot", InputBinding::Key(KeyCode::F12))
+            .BindAction("ToggleProfiler", InputBinding::Key(KeyCode::F9))
+        );
+    }
+
+    Application::~Application()
+    {
+        HitchWatchdog::Stop();
+        SamplingProfiler::Shutdown();
+        TaskScheduler::Shutdown();
+        DeferredWork::Shutdown();
+        IO::Shutdown();
+        EventInjector::Shutdown();
+
+        EventInterest::Remove(EventMaskOf<WindowClosedEvent, WindowMinimizeEvent>);
+
+        PerfCounters::Shutdown();
+        Metrics::Registry::Shutdown();
+        FlightRecorder::Uninstall();
     }
 
     void Application::Run()
     {
+        static Metrics::Histogram& frameTime = Metrics::Registry::GetHistogram("frame.time_us");
+        static Metrics::Gauge& frameTimeMs = Metrics::Registry::GetGauge("frame.time_ms");
+
         while (m_Running) {
             m_Timer->Tick();
+            frameTime.Record(static_cast<u64>(m_Timer->GetDeltaTime() * 1e6f));
+            frameTimeMs.Set(m_Timer->GetDeltaTime() * 1000.0);
+            FlightRecorder::RecordFrame(m_Timer->GetDeltaTime(), m_Timer->GetScaledDeltaTime());
+            HitchWatchdog::Heartbeat(FlightRecorder::GetFrame());
+
+            PerfCounters::BeginFrame();
 
             Window::PollEvents();
+            EventInjector::Update();
+            PerfCounters::EndPhase(FramePhase::Poll);
+
             Input::Update();
+            PerfCounters::EndPhase(FramePhase::Input);
+
+            IO::Update();
+            PerfCounters::EndPhase(FramePhase::IO);
 
             ProcessEvents();
+            // Actions see the key and button events dispatched just above, not last frame's
+            InputActions::Evaluate();
+            PerfCounters::EndPhase(FramePhase::Events);
+
+            s_RealTimers.Advance(m_Timer->GetDeltaTime());
+            s_ScaledTimers.Advance(m_Timer->GetScaledDeltaTime());
+            PerfCounters::EndPhase(FramePhase::Timers);
+
+            TaskScheduler::Update();
+            PerfCounters::EndPhase(FramePhase::Tasks);
+
+            if (InputActions::IsPressed(m_ProfilerAction)) {
+                ToggleProfiler();
+            }
+            SamplingProfiler::Update();
 
             // NOTE: Maybe we dont want this?
-            if (Input::IsKeyDown(KeyCode::Escape)) {
+            if (InputActions::IsDown(m_QuitAction)) {
                 m_Running = false;
             }
 
             if (!m_Minimized) {
+                RenderFrame();
             }
+            PerfCounters::EndPhase(FramePhase::Render);
+
+            DeferredWork::Drain(m_Timer->GetTimeSinceTick());
+            PerfCounters::EndPhase(FramePhase::Deferred);
+
+            Metrics::Registry::Publish();
+            PerfCounters::EndPhase(FramePhase::Metrics);
+
+            PerfCounters::EndFrame();
         }
     }
 
+    void Application::RenderFrame()
+    {
+        static Metrics::Gauge& setupTime = Metrics::Registry::GetGauge("renderer.setup_ms");
+        static Metrics::Gauge& rasterTime = Metrics::Registry::GetGauge("renderer.raster_ms");
+        static Metrics::Gauge& triangles = Metrics::Registry::GetGauge("renderer.triangles");
+
+        const Renderer::Framebuffer& framebuffer = m_Renderer->GetFramebuffer();
+        if (framebuffer.GetWidth() != m_Window->GetWidth() || framebuffer.GetHeight() != m_Window->GetHeight()) {
+            m_Renderer->Resize(m_Window->GetWidth(), m_Window->GetHeight());
+        }
+
+        // Systems submit geometry while the world updates
+        m_Renderer->BeginFrame(Renderer::PackColor(20, 20, 24));
+        m_World->Update(m_Timer->GetScaledDeltaTime());
+        m_Renderer->EndFrame();
+
+        Renderer::Present(m_Renderer->GetFramebuffer(), *m_Window);
+
+        const Renderer::RasterStats& stats = m_Renderer->GetStats();
+        setupTime.Set(stats.setupMs);
+        rasterTime.Set(stats.rasterMs);
+        triangles.Set(static_cast<f64>(stats.submitted - stats.culled));
+
+        if (InputActions::IsPressed(m_ScreenshotAction)) {
+            std::filesystem::create_directories("screenshots");
+
+            const std::string path = std::format("screenshots/Frame-{}.tga", FlightRecorder::GetFrame());
+            if (auto result = m_Renderer->GetFramebuffer().Save(path)) {
+                LOG_INFO("Saved screenshot {}", path);
+            } else {
+                LOG_ERROR("Failed to save screenshot: {}", result.error());
+            }
+        }
+    }
+
+    void Application::ToggleProfiler()
+    {
+        if (SamplingProfiler::IsRunning()) {
+            if (auto result = SamplingProfiler::Stop(); !result) {
+                LOG_ERROR("Failed to stop the profiler: {}", result.error());
+            }
+        } else if (auto result = SamplingProfiler::Start(m_ProfilerConfig); !result) {
+            LOG_ERROR("Failed to start the profiler: {}", result.error());
+        }
+    }
+
+    ListenerHandle Application::RegisterOnEvent(EventListenerFn fn, EventMask interest)
+    {
+        const ListenerHandle handle = s_EventListeners.Add(std::move(fn));
+
+        if (handle.index >= s_ListenerInterests.size()) {
+            s_ListenerInterests.resize(handle.index + 1);
+        }
+        s_ListenerInterests[handle.index] = interest;
+
+        EventInterest::Add(interest);
+
+        return handle;
+    }
+
+    bool Application::UnregisterOnEvent(ListenerHandle handle)
+    {
+        if (!s_EventListeners.Remove(handle)) return false;
+
+        EventInterest::Remove(s_ListenerInterests[handle.index]);
+        return true;
+    }
+
     void Application::ProcessEvents()
     {
-        for (auto& event : m_EventQueue->Poll()) {
+        static Metrics::Histogram& eventsPerFrame = Metrics::Registry::GetHistogram("app.events_per_frame");
+        static Metrics::Gauge& listenerCount = Metrics::Registry::GetGauge("app.listeners");
+        static Metrics::Counter& queuePushed = Metrics::Registry::GetCounter("event_queue.pushed");
+        static Metrics::Counter& queueDropped = Metrics::Registry::GetCounter("event_queue.dropped");
+        static Metrics::Gauge& queueDepth = Metrics::Registry::GetGauge("event_queue.depth");
+
+        auto events = m_EventQueue->Poll();
+        auto channelEvents = s_EventChannel.Collect();
+
+        eventsPerFrame.Record(events.size() + channelEvents.size());
+        listenerCount.Set(static_cast<f64>(s_EventListeners.GetCount()));
+
+        // Every pushed event is polled exactly once, so the frame's poll is its share of the pushes
+        queuePushed.Increment(events.size());
+        queueDropped.Increment(m_EventQueue->GetDroppedCount() - queueDropped.Get());
+        queueDepth.Set(static_cast<f64>(events.size()));
+
+        // Both streams are already in sequence order, merge them so listeners see events as they were pushed
+        auto nextChannelEvent = channelEvents.begin();
+
+        for (auto& [sequence, event] : events) {
+            for (; nextChannelEvent != channelEvents.end() && nextChannelEvent->sequence < sequence; ++nextChannelEvent) {
+                s_EventChannel.Dispatch(*nextChannelEvent);
+            }
+
+            FlightRecorder::RecordEvent(event);
+
             EventDispatcher<CoreEvents> dispatcher(event);
 
             dispatcher.Dispatch<WindowClosedEvent>([&](const WindowClosedEvent&) {
@@ -51,10 +241,16 @@ namespace Core {
                 return false;
             });
 
-            for (const auto& listener : s_EventListeners) {
-                listener(dispatcher);
-            }
+            s_EventListeners.Invoke(dispatcher);
+
+            TaskScheduler::OnEvent(event);
         }
+
+        for (; nextChannelEvent != channelEvents.end(); ++nextChannelEvent) {
+            s_EventChannel.Dispatch(*nextChannelEvent);
+        }
+
+        s_EventChannel.Release();
     }
 
 }
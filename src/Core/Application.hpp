@@ -1,40 +1,95 @@
 #pragma once
 
 #include "Timer.hpp"
+#include "TimerWheel.hpp"
+#include "Delegate.hpp"
+#include "DeferredWork.hpp"
 #include "Events/CoreEvents.hpp"
+#include "Events/ListenerList.hpp"
+#include "Events/EventChannel.hpp"
+#include "Events/EventInterest.hpp"
+#include "Events/EventInjector.hpp"
 #include "Window.hpp"
+#include "InputActions.hpp"
+#include "Threading.hpp"
+#include "IO/IO.hpp"
+#include "Profiling/HitchWatchdog.hpp"
+#include "Profiling/PerfCounters.hpp"
+#include "Profiling/SamplingProfiler.hpp"
+#include "ECS/World.hpp"
+#include "Renderer/SoftwareRenderer.hpp"
 
 namespace Core {
 
     class Application
     {
     public:
-        using EventListenerFn = std::function<void(EventDispatcher<CoreEvents>&)>;
+        using EventListenerFn = Delegate<void(EventDispatcher<CoreEvents>&)>;
+
+        struct Config
+        {
+            Threading::Config threading;
+            IO::Config io;
+            SamplingProfiler::Config profiler;
+            PerfCounters::Config perfCounters;
+            HitchWatchdog::Config watchdog;
+            DeferredWork::Config deferredWork;
+            EventInjector::Config injection;
+        };
 
     public:
-        Application();
-        ~Application() = default;
+        Application(const Config& config = Config());
+        ~Application();
 
         void Run();
 
-        inline static void RegisterOnEvent(const EventListenerFn& fn)
+        [[nodiscard]] inline ECS::World& GetWorld() { return *m_World; }
+        [[nodiscard]] inline Renderer::SoftwareRenderer& GetRenderer() { return *m_Renderer; }
+
+        // The interest mask decides which window callbacks stay installed, pass only the events the listener handles
+        static ListenerHandle RegisterOnEvent(EventListenerFn fn, EventMask interest);
+        static bool UnregisterOnEvent(ListenerHandle handle);
+
+        // Events outside CoreEvents, dispatched interleaved with core events in push order
+        inline static EventChannel& GetEventChannel()
         {
-            s_EventListeners.push_back(fn);
+            return s_EventChannel;
+        }
+
+        inline static TimerWheel& GetTimers(TimeDomain domain = TimeDomain::Scaled)
+        {
+            return domain == TimeDomain::Real ? s_RealTimers : s_ScaledTimers;
         }
 
     private:
         void ProcessEvents();
+        void RenderFrame();
+        void ToggleProfiler();
     
     private:
         bool m_Running { true };
         bool m_Minimized { false };
 
+        ActionID m_QuitAction;
+        ActionID m_ScreenshotAction;
+        ActionID m_ProfilerAction;
+
+        SamplingProfiler::Config m_ProfilerConfig;
+
         std::unique_ptr<Timer> m_Timer;
 
         std::unique_ptr<EventQueue<CoreEvents>> m_EventQueue;
         std::shared_ptr<Window> m_Window;
 
-        inline static std::vector<EventListenerFn> s_EventListeners;
+        std::unique_ptr<ECS::World> m_World;
+        std::unique_ptr<Renderer::SoftwareRenderer> m_Renderer;
+
+        inline static ListenerList<EventListenerFn> s_EventListeners;
+        inline static std::vector<EventMask> s_ListenerInterests;
+        inline static EventChannel s_EventChannel;
+
+        inline static TimerWheel s_RealTimers;
+        inline static TimerWheel s_ScaledTimers;
     };
 
 }
@@ -0,0 +1,263 @@
+#include "AssetPack.hpp"
+
+#include "LZ4.hpp"
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Core {
+
+    namespace {
+
+        std::expected<std::span<const std::byte>, std::string> MapFile(const std::filesystem::path& path)
+        {
+#if defined(_WIN32)
+            HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                return std::unexpected(std::format("Failed to open {}: error {}", path.string(), GetLastError()));
+            }
+
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+                CloseHandle(file);
+                return std::unexpected(std::format("{} is empty", path.string()));
+            }
+
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);
+            if (!mapping) {
+                return std::unexpected(std::format("Failed to map {}: error {}", path.string(), GetLastError()));
+            }
+
+            // The view keeps the mapping object alive
+            const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (!view) {
+                return std::unexpected(std::format("Failed to map {}: error {}", path.string(), GetLastError()));
+            }
+
+            return std::span(static_cast<const std::byte*>(view), static_cast<usize>(size.QuadPart));
+#else
+            const i32 fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                return std::unexpected(std::format("Failed to open {}: {}", path.string(), std::strerror(errno)));
+            }
+
+            struct stat info {};
+            if (fstat(fd, &info) != 0 || info.st_size == 0) {
+                close(fd);
+                return std::unexpected(std::format("{} is empty", path.string()));
+            }
+
+            void* mapping = mmap(nullptr, static_cast<usize>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+            close(fd);
+
+            if (mapping == MAP_FAILED) {
+                return std::unexpected(std::format("Failed to map {}: {}", path.string(), std::strerror(errno)));
+            }
+
+            return std::span(static_cast<const std::byte*>(mapping), static_cast<usize>(info.st_size));
+#endif
+        }
+
+        inline bool InRange(u64 offset, u64 size, u64 begin, u64 end) noexcept
+        {
+            return offset >= begin && offset <= end && size <= end - offset;
+        }
+
+    }
+
+    std::expected<AssetPack, std::string> AssetPack::Open(const std::filesystem::path& path)
+    {
+        auto mapped = MapFile(path);
+        if (!mapped) return std::unexpected(mapped.error());
+
+        AssetPack pack;
+        pack.m_Mapping = mapped->data();
+        pack.m_Size = mapped->size();
+
+        auto fail = [&](std::string_view reason) {
+            return std::unexpected(std::format("Invalid asset pack {}: {}", path.string(), reason));
+        };
+
+        if (pack.m_Size < sizeof(AssetPackHeader)) return fail("truncated header");
+
+        const AssetPackHeader& header = *reinterpret_cast<const AssetPackHeader*>(pack.m_Mapping);
+        if (header.magic != AssetPackMagic) return fail("bad magic");
+        if (header.version != AssetPackVersion) return fail(std::format("version {}, expected {}", header.version, AssetPackVersion));
+        if (header.alignment == 0 || !std::has_single_bit(header.alignment)) return fail("bad alignment");
+
+        const u64 indexSize = static_cast<u64>(header.entryCount) * sizeof(AssetPackEntry);
+        if (!InRange(header.indexOffset, indexSize, sizeof(AssetPackHeader), pack.m_Size)) return fail("index out of bounds");
+        if (header.indexOffset % alignof(AssetPackEntry) != 0) return fail("misaligned index");
+        if (!InRange(header.namesOffset, header.namesSize, 0, pack.m_Size)) return fail("names out of bounds");
+        if (!InRange(header.dataOffset, header.dataSize, 0, pack.m_Size)) return fail("data out of bounds");
+
+        pack.m_Header = &header;
+        pack.m_Entries = std::span(reinterpret_cast<const AssetPackEntry*>(pack.m_Mapping + header.indexOffset), header.entryCount);
+        pack.m_Names = std::string_view(reinterpret_cast<const char*>(pack.m_Mapping + header.namesOffset), header.namesSize);
+
+        // Every lookup walks the index and names, fault them in together up front
+        pack.Advise(0, header.namesOffset + header.namesSize);
+
+        u64 previousHash = 0;
+        for (const AssetPackEntry& entry : pack.m_Entries) {
+            if (entry.hash < previousHash) return fail("index is not sorted");
+            if (!InRange(entry.nameOffset, entry.nameLength, 0, header.namesSize)) return fail("name out of bounds");
+            if (!InRange(entry.offset, entry.storedSize, header.dataOffset, header.dataOffset + header.dataSize)) return fail("blob out of bounds");
+            if (!entry.IsCompressed() && entry.storedSize != entry.size) return fail("size mismatch");
+            if (entry.IsCompressed() && entry.size > LZ4::GetMaxDecompressedSize(entry.storedSize)) return fail("size exceeds what the blob can expand to");
+            previousHash = entry.hash;
+        }
+
+        return pack;
+    }
+
+    AssetPack::AssetPack(AssetPack&& other) noexcept
+        : m_Mapping(std::exchange(other.m_Mapping, nullptr)),
+          m_Size(std::exchange(other.m_Size, 0)),
+          m_Header(std::exchange(other.m_Header, nullptr)),
+          m_Entries(std::exchange(other.m_Entries, {})),
+          m_Names(std::exchange(other.m_Names, {}))
+    {
+    }
+
+    AssetPack& AssetPack::operator=(AssetPack&& other) noexcept
+    {
+        if (this != &other) {
+            Unmap();
+            m_Mapping = std::exchange(other.m_Mapping, nullptr);
+            m_Size = std::exchange(other.m_Size, 0);
+            m_Header = std::exchange(other.m_Header, nullptr);
+            m_Entries = std::exchange(other.m_Entries, {});
+            m_Names = std::exchange(other.m_Names, {});
+        }
+        return *this;
+    }
+
+    AssetPack::~AssetPack()
+    {
+        Unmap();
+    }
+
+    const AssetPackEntry* AssetPack::Find(std::string_view path) const noexcept
+    {
+        const u64 hash = HashAssetPath(path);
+
+        auto it = std::ranges::lower_bound(m_Entries, hash, {}, &AssetPackEntry::hash);
+
+        // Colliding hashes sit next to each other, tell them apart by name
+        for (; it != m_Entries.end() && it->hash == hash; ++it) {
+            if (GetName(*it) == path) return &*it;
+        }
+
+        return nullptr;
+    }
+
+    std::span<const std::byte> AssetPack::View(std::string_view path) const noexcept
+    {
+        const AssetPackEntry* entry = Find(path);
+        if (!entry || entry->IsCompressed()) return {};
+
+        return GetStoredData(*entry);
+    }
+
+    std::span<const std::byte> AssetPack::GetStoredData(const AssetPackEntry& entry) const noexcept
+    {
+        return std::span(m_Mapping + entry.offset, entry.storedSize);
+    }
+
+    std::expected<void, std::string> AssetPack::Read(const AssetPackEntry& entry, std::span<std::byte> out) const
+    {
+        if (out.size() < entry.size) {
+            return std::unexpected(std::format("{} needs {} bytes, buffer holds {}", GetName(entry), entry.size, out.size()));
+        }
+
+        const std::span<const std::byte> stored = GetStoredData(entry);
+
+        if (!entry.IsCompressed()) {
+            std::memcpy(out.data(), stored.data(), stored.size());
+            return {};
+        }
+
+        const std::optional<usize> size = LZ4::Decompress(stored, out.first(entry.size));
+        if (!size || *size != entry.size) {
+            return std::unexpected(std::format("{} is corrupt", GetName(entry)));
+        }
+
+        return {};
+    }
+
+    std::expected<std::vector<std::byte>, std::string> AssetPack::Load(std::string_view path) const
+    {
+        const AssetPackEntry* entry = Find(path);
+        if (!entry) {
+            return std::unexpected(std::format("{} is not in the pack", path));
+        }
+
+        std::vector<std::byte> data(entry->size);
+        if (auto result = Read(*entry, data); !result) {
+            return std::unexpected(result.error());
+        }
+
+        return data;
+    }
+
+    void AssetPack::Prefetch(const AssetPackEntry& entry) const noexcept
+    {
+        Advise(entry.offset, entry.storedSize);
+    }
+
+    void AssetPack::Prefetch(std::string_view path) const noexcept
+    {
+        if (const AssetPackEntry* entry = Find(path)) {
+            Prefetch(*entry);
+        }
+    }
+
+    void AssetPack::PrefetchAll() const noexcept
+    {
+        if (m_Header) Advise(m_Header->dataOffset, m_Header->dataSize);
+    }
+
+    std::string_view AssetPack::GetName(const AssetPackEntry& entry) const noexcept
+    {
+        return m_Names.substr(entry.nameOffset, entry.nameLength);
+    }
+
+    void AssetPack::Advise(u64 offset, u64 size) const noexcept
+    {
+        if (!m_Mapping || size == 0) return;
+
+        // Widen to whole pages, the mapping itself starts on one
+        constexpr u64 PageSize = 4096;
+        const u64 begin = offset & ~(PageSize - 1);
+        const u64 end = std::min<u64>(offset + size, m_Size);
+
+#if defined(_WIN32)
+        WIN32_MEMORY_RANGE_ENTRY range { const_cast<std::byte*>(m_Mapping) + begin, static_cast<SIZE_T>(end - begin) };
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+        madvise(const_cast<std::byte*>(m_Mapping) + begin, static_cast<usize>(end - begin), MADV_WILLNEED);
+#endif
+    }
+
+    void AssetPack::Unmap() noexcept
+    {
+        if (!m_Mapping) return;
+
+#if defined(_WIN32)
+        UnmapViewOfFile(m_Mapping);
+#else
+        munmap(const_cast<std::byte*>(m_Mapping), m_Size);
+#endif
+        m_Mapping = nullptr;
+    }
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "AssetPackLayout.hpp"
+
+namespace Core {
+
+    // Read-only view of a pack file mapped into memory. Lookups binary search
+    // the sorted hash index in place; uncompressed assets are returned as spans
+    // into the mapping, so nothing is copied and pages fault in on first touch.
+    // Paths are relative to the packed directory and use '/' separators.
+    class AssetPack
+    {
+    public:
+        static std::expected<AssetPack, std::string> Open(const std::filesystem::path& path);
+
+        AssetPack(AssetPack&& other) noexcept;
+        AssetPack& operator=(AssetPack&& other) noexcept;
+        ~AssetPack();
+
+        AssetPack(const AssetPack&) = delete;
+        AssetPack& operator=(const AssetPack&) = delete;
+
+        [[nodiscard]] const AssetPackEntry* Find(std::string_view path) const noexcept;
+
+        // Zero-copy view, empty if the asset is missing or compressed
+        [[nodiscard]] std::span<const std::byte> View(std::string_view path) const noexcept;
+        [[nodiscard]] std::span<const std::byte> GetStoredData(const AssetPackEntry& entry) const noexcept;
+
+        // Copies or decompresses into out, which must hold entry.size bytes
+        std::expected<void, std::string> Read(const AssetPackEntry& entry, std::span<std::byte> out) const;
+        std::expected<std::vector<std::byte>, std::string> Load(std::string_view path) const;
+
+        // Asks the kernel to start reading the pages in now, without waiting for them
+        void Prefetch(const AssetPackEntry& entry) const noexcept;
+        void Prefetch(std::string_view path) const noexcept;
+        void PrefetchAll() const noexcept;
+
+        [[nodiscard]] std::string_view GetName(const AssetPackEntry& entry) const noexcept;
+        [[nodiscard]] inline std::span<const AssetPackEntry> GetEntries() const noexcept { return m_Entries; }
+        [[nodiscard]] inline usize GetMappedSize() const noexcept { return m_Size; }
+
+    private:
+        AssetPack() = default;
+
+        void Advise(u64 offset, u64 size) const noexcept;
+        void Unmap() noexcept;
+
+    private:
+        const std::byte* m_Mapping = nullptr;
+        usize m_Size = 0;
+
+        const AssetPackHeader* m_Header = nullptr;
+        std::span<const AssetPackEntry> m_Entries;
+        std::string_view m_Names;
+    };
+
+}
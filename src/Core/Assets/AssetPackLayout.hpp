@@ -0,0 +1,74 @@
+#pragma once
+
+// On-disk layout of asset packs written by the AssetPacker tool and mapped
+// by AssetPack. Bump AssetPackVersion on any change to these structs.
+//
+//   [header][index: entryCount entries sorted by hash][names][data, each blob aligned]
+//
+// All integers are little endian. Offsets are from the start of the file,
+// and the data section starts on a page boundary so blob alignment holds in
+// the mapping too.
+
+namespace Core {
+
+    inline constexpr u32 AssetPackMagic = 0x4B415041; // "APAK"
+    inline constexpr u32 AssetPackVersion = 1;
+
+    inline constexpr u32 AssetPackDefaultAlignment = 64;
+    inline constexpr u32 AssetPackDataAlignment = 4096;
+
+    enum class AssetEntryFlags : u32
+    {
+        None = 0,
+        LZ4  = 1 << 0
+    };
+
+    struct AssetPackHeader
+    {
+        u32 magic;
+        u32 version;
+        u32 entryCount;
+        u32 alignment;
+
+        u64 indexOffset;
+        u64 namesOffset;
+        u64 namesSize;
+        u64 dataOffset;
+        u64 dataSize;
+
+        u64 reserved;
+    };
+
+    struct AssetPackEntry
+    {
+        u64 hash;
+        u64 offset;
+        u64 storedSize;
+        u64 size;
+        u32 nameOffset;
+        u32 nameLength;
+        AssetEntryFlags flags;
+        u32 reserved;
+
+        [[nodiscard]] constexpr bool IsCompressed() const noexcept
+        {
+            return (static_cast<u32>(flags) & static_cast<u32>(AssetEntryFlags::LZ4)) != 0;
+        }
+    };
+
+    static_assert(sizeof(AssetPackHeader) == 64);
+    static_assert(sizeof(AssetPackEntry) == 48);
+    static_assert(std::endian::native == std::endian::little, "Asset packs are read in place and stored little endian");
+
+    // FNV-1a over the path as stored in the pack: relative, with '/' separators
+    [[nodiscard]] constexpr u64 HashAssetPath(std::string_view path) noexcept
+    {
+        u64 hash = 0xCBF29CE484222325ull;
+        for (char c : path) {
+            hash ^= static_cast<u8>(c);
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+}
@@ -0,0 +1,181 @@
+#include "LZ4.hpp"
+
+namespace Core::LZ4 {
+
+    namespace {
+
+        constexpr usize MinMatch = 4;
+        constexpr usize LastLiterals = 5;   // The block always ends in at least this many literals
+        constexpr usize MatchFindLimit = 12; // No match may start closer than this to the end
+        constexpr usize MaxOffset = 65535;
+
+        constexpr u32 HashBits = 12;
+
+        inline u32 Read32(const std::byte* ptr) noexcept
+        {
+            u32 value;
+            std::memcpy(&value, ptr, sizeof(value));
+            return value;
+        }
+
+        inline u32 HashSequence(u32 sequence) noexcept
+        {
+            return (sequence * 2654435761u) >> (32 - HashBits);
+        }
+
+        // Writes the 255-run continuation of a length whose nibble saturated at 15
+        inline std::byte* WriteLength(std::byte* out, usize length) noexcept
+        {
+            for (; length >= 255; length -= 255) {
+                *out++ = std::byte { 255 };
+            }
+            *out++ = static_cast<std::byte>(length);
+            return out;
+        }
+
+        // Emits one sequence; a match length of 0 marks the final literal-only sequence
+        inline bool WriteSequence(std::byte*& out, const std::byte* end, const std::byte* literals, usize literalLength, usize offset, usize matchLength) noexcept
+        {
+            const usize worstCase = 1 + literalLength / 255 + 1 + literalLength + 2 + matchLength / 255 + 1;
+            if (static_cast<usize>(end - out) < worstCase) return false;
+
+            std::byte* token = out++;
+            u8 tokenValue = static_cast<u8>(std::min<usize>(literalLength, 15) << 4);
+
+            if (literalLength >= 15) out = WriteLength(out, literalLength - 15);
+            if (literalLength > 0) std::memcpy(out, literals, literalLength);
+            out += literalLength;
+
+            if (matchLength > 0) {
+                *out++ = static_cast<std::byte>(offset & 0xFF);
+                *out++ = static_cast<std::byte>(offset >> 8);
+
+                const usize code = matchLength - MinMatch;
+                tokenValue |= static_cast<u8>(std::min<usize>(code, 15));
+                if (code >= 15) out = WriteLength(out, code - 15);
+            }
+
+            *token = static_cast<std::byte>(tokenValue);
+            return true;
+        }
+
+    }
+
+    usize Compress(std::span<const std::byte> src, std::span<std::byte> dst) noexcept
+    {
+        const std::byte* base = src.data();
+        const usize size = src.size();
+
+        std::byte* out = dst.data();
+        const std::byte* outEnd = dst.data() + dst.size();
+
+        usize anchor = 0;
+
+        if (size > MatchFindLimit) {
+            std::array<u32, 1u << HashBits> table;
+            table.fill(0);
+
+            const usize matchStartLimit = size - MatchFindLimit;
+            const usize matchEndLimit = size - LastLiterals;
+
+            usize position = 0;
+            u32 misses = 0;
+
+            while (position < matchStartLimit) {
+                const u32 sequence = Read32(base + position);
+                const u32 hash = HashSequence(sequence);
+                usize candidate = table[hash];
+                table[hash] = static_cast<u32>(position);
+
+                if (candidate >= position || position - candidate > MaxOffset || Read32(base + candidate) != sequence) {
+                    // Step faster through data that does not compress
+                    position += 1 + (misses++ >> 6);
+                    continue;
+                }
+                misses = 0;
+
+                while (position > anchor && candidate > 0 && base[position - 1] == base[candidate - 1]) {
+                    --position;
+                    --candidate;
+                }
+
+                usize length = MinMatch;
+                while (position + length < matchEndLimit && base[candidate + length] == base[position + length]) {
+                    ++length;
+                }
+
+                if (!WriteSequence(out, outEnd, base + anchor, position - anchor, position - candidate, length)) return 0;
+
+                position += length;
+                anchor = position;
+
+                if (position - 2 < matchStartLimit) {
+                    table[HashSequence(Read32(base + position - 2))] = static_cast<u32>(position - 2);
+                }
+            }
+        }
+
+        if (!WriteSequence(out, outEnd, base + anchor, size - anchor, 0, 0)) return 0;
+
+        return static_cast<usize>(out - dst.data());
+    }
+
+    std::optional<usize> Decompress(std::span<const std::byte> src, std::span<std::byte> dst) noexcept
+    {
+        const std::byte* in = src.data();
+        const std::byte* inEnd = src.data() + src.size();
+        std::byte* out = dst.data();
+        std::byte* outEnd = dst.data() + dst.size();
+
+        auto readLength = [&](usize& length) {
+            u8 next;
+            do {
+                if (in == inEnd) return false;
+                next = static_cast<u8>(*in++);
+                length += next;
+            } while (next == 255);
+            return true;
+        };
+
+        for (;;) {
+            if (in == inEnd) return std::nullopt;
+            const u8 token = static_cast<u8>(*in++);
+
+            usize literalLength = token >> 4;
+            if (literalLength == 15 && !readLength(literalLength)) return std::nullopt;
+
+            if (static_cast<usize>(inEnd - in) < literalLength || static_cast<usize>(outEnd - out) < literalLength) return std::nullopt;
+            if (literalLength > 0) std::memcpy(out, in, literalLength);
+            in += literalLength;
+            out += literalLength;
+
+            if (in == inEnd) break;
+
+            if (inEnd - in < 2) return std::nullopt;
+            const usize offset = static_cast<usize>(in[0]) | (static_cast<usize>(in[1]) << 8);
+            in += 2;
+
+            if (offset == 0 || offset > static_cast<usize>(out - dst.data())) return std::nullopt;
+
+            usize matchLength = token & 15;
+            if (matchLength == 15 && !readLength(matchLength)) return std::nullopt;
+            matchLength += MinMatch;
+
+            if (static_cast<usize>(outEnd - out) < matchLength) return std::nullopt;
+
+            const std::byte* match = out - offset;
+            if (offset >= matchLength) {
+                std::memcpy(out, match, matchLength);
+                out += matchLength;
+            } else {
+                // Overlapping copy repeats the last offset bytes
+                for (usize i = 0; i < matchLength; ++i) {
+                    *out++ = match[i];
+                }
+            }
+        }
+
+        return static_cast<usize>(out - dst.data());
+    }
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+// LZ4 block format (no frame header), compatible with the reference
+// implementation's LZ4_compress_default / LZ4_decompress_safe.
+namespace Core::LZ4 {
+
+    [[nodiscard]] constexpr usize GetMaxCompressedSize(usize size) noexcept
+    {
+        return size + size / 255 + 16;
+    }
+
+    // No input byte expands to more than 255 output bytes
+    [[nodiscard]] constexpr u64 GetMaxDecompressedSize(u64 compressedSize) noexcept
+    {
+        return compressedSize * 255;
+    }
+
+    // Returns the compressed size, or 0 if dst is too small
+    usize Compress(std::span<const std::byte> src, std::span<std::byte> dst) noexcept;
+
+    // Returns the decompressed size, or nullopt if src is malformed or does not fit in dst
+    std::optional<usize> Decompress(std::span<const std::byte> src, std::span<std::byte> dst) noexcept;
+
+}
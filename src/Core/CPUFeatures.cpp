@@ -0,0 +1,65 @@
+#include "CPUFeatures.hpp"
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace Core {
+
+    namespace {
+
+        CPUFeatures Detect()
+        {
+            CPUFeatures features;
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #if defined(_MSC_VER)
+            i32 info[4];
+
+            __cpuid(info, 0);
+            const i32 maxLeaf = info[0];
+
+            __cpuid(info, 1);
+            features.sse2 = (info[3] >> 26) & 1;
+            features.sse41 = (info[2] >> 19) & 1;
+            features.fma = (info[2] >> 12) & 1;
+
+            // AVX state must also be enabled by the OS, which XGETBV reports
+            const bool osxsave = (info[2] >> 27) & 1;
+            const u64 xcr0 = osxsave ? _xgetbv(0) : 0;
+            features.avx = ((info[2] >> 28) & 1) && (xcr0 & 0x6) == 0x6;
+
+            if (maxLeaf >= 7) {
+                __cpuidex(info, 7, 0);
+                features.avx2 = features.avx && ((info[1] >> 5) & 1);
+                features.avx512f = features.avx && ((info[1] >> 16) & 1) && (xcr0 & 0xE6) == 0xE6;
+            }
+    #else
+            __builtin_cpu_init();
+            features.sse2 = __builtin_cpu_supports("sse2");
+            features.sse41 = __builtin_cpu_supports("sse4.1");
+            features.avx = __builtin_cpu_supports("avx");
+            features.avx2 = __builtin_cpu_supports("avx2");
+            features.fma = __builtin_cpu_supports("fma");
+            features.avx512f = __builtin_cpu_supports("avx512f");
+    #endif
+#endif
+
+            return features;
+        }
+
+    }
+
+    const CPUFeatures& CPUFeatures::Get()
+    {
+        static const CPUFeatures features = [] {
+            CPUFeatures detected = Detect();
+            LOG_DEBUG("CPU features: sse2 {}, sse4.1 {}, avx {}, avx2 {}, fma {}, avx512f {}",
+                detected.sse2, detected.sse41, detected.avx, detected.avx2, detected.fma, detected.avx512f);
+            return detected;
+        }();
+
+        return features;
+    }
+
+}
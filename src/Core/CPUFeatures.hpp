@@ -0,0 +1,19 @@
+#pragma once
+
+namespace Core {
+
+    // Instruction set support of the running CPU, probed once. Kernels built
+    // with wider instruction sets must check this before being called.
+    struct CPUFeatures
+    {
+        bool sse2 = false;
+        bool sse41 = false;
+        bool avx = false;
+        bool avx2 = false;
+        bool fma = false;
+        bool avx512f = false;
+
+        [[nodiscard]] static const CPUFeatures& Get();
+    };
+
+}
@@ -0,0 +1,201 @@
+#include "DeferredWork.hpp"
+
+#include "Metrics/Metrics.hpp"
+
+namespace Core {
+
+    DeferredWorkHandle DeferredWork::Enqueue(std::string_view kind, Callback callback, WorkPriority priority, std::optional<f32> deadline)
+    {
+        if (!callback) return {};
+
+        u32 index;
+        if (!s_FreeItems.empty()) {
+            index = s_FreeItems.back();
+            s_FreeItems.pop_back();
+        } else {
+            index = static_cast<u32>(s_Items.size());
+            s_Items.emplace_back();
+        }
+
+        const f64 now = GetTime();
+
+        Item& item = s_Items[index];
+        item.callback = std::move(callback);
+        item.enqueued = now;
+        item.deadline = deadline ? now + static_cast<f64>(*deadline) : std::numeric_limits<f64>::infinity();
+        item.kind = GetKind(kind);
+        item.skipped = 0;
+        item.priority = priority;
+
+        s_Pending.push_back(index);
+
+        return DeferredWorkHandle { index, item.generation };
+    }
+
+    bool DeferredWork::Cancel(DeferredWorkHandle handle)
+    {
+        if (!IsPending(handle)) return false;
+
+        std::erase(s_Pending, handle.index);
+        Free(handle.index);
+
+        return true;
+    }
+
+    bool DeferredWork::IsPending(DeferredWorkHandle handle)
+    {
+        return handle.IsValid()
+            && handle.index < s_Items.size()
+            && s_Items[handle.index].generation == handle.generation
+            && s_Items[handle.index].callback;
+    }
+
+    f32 DeferredWork::GetEstimatedCost(std::string_view kind)
+    {
+        auto it = s_KindIndices.find(kind);
+        return it != s_KindIndices.end() ? static_cast<f32>(s_Kinds[it->second].cost) : s_Config.defaultCost;
+    }
+
+    void DeferredWork::Init(const Config& config)
+    {
+        s_Config = config;
+        s_Stats = {};
+    }
+
+    void DeferredWork::Shutdown()
+    {
+        if (!s_Pending.empty()) {
+            LOG_DEBUG("Dropping {} deferred work item(s) on shutdown", s_Pending.size());
+        }
+
+        s_Items.clear();
+        s_FreeItems.clear();
+        s_Pending.clear();
+        s_Candidates.clear();
+    }
+
+    void DeferredWork::Drain(f32 frameTime)
+    {
+        static Metrics::Gauge& budgetGauge = Metrics::Registry::GetGauge("deferred.budget_ms");
+        static Metrics::Gauge& usedGauge = Metrics::Registry::GetGauge("deferred.used_ms");
+        static Metrics::Gauge& pendingGauge = Metrics::Registry::GetGauge("deferred.pending");
+        static Metrics::Counter& forcedCounter = Metrics::Registry::GetCounter("deferred.forced");
+
+        const f64 start = GetTime();
+        const f64 budget = std::max(0.0, static_cast<f64>(s_Config.frameBudget - frameTime));
+
+        s_Stats = {};
+        s_Stats.budgetMs = static_cast<f32>(budget * 1000.0);
+
+        // Work enqueued by the callbacks below waits for the next frame
+        s_Candidates.clear();
+        for (u32 index : s_Pending) {
+            const Item& item = s_Items[index];
+            if (!item.callback) continue;
+
+            const f64 waited = start - item.enqueued;
+            const f64 score = static_cast<f64>(item.priority) + static_cast<f64>(s_Config.agingRate) * waited;
+
+            s_Candidates.push_back(Candidate { score, index, item.generation, item.deadline <= start });
+        }
+
+        std::ranges::sort(s_Candidates, [](const Candidate& a, const Candidate& b) {
+            return a.overdue != b.overdue ? a.overdue : a.score > b.score;
+        });
+
+        // Only one starved item per frame, so a backlog that starved together does not land in a single frame
+        bool ranStarved = false;
+
+        for (const Candidate& candidate : s_Candidates) {
+            // Cancelled, or cancelled and reused, by an earlier callback
+            Item& item = s_Items[candidate.index];
+            if (item.generation != candidate.generation || !item.callback) continue;
+
+            const f64 remaining = budget - (GetTime() - start);
+
+            if (candidate.overdue) {
+                ++s_Stats.forced;
+            } else if (s_Kinds[item.kind].cost > remaining) {
+                // Smaller items further down may still fit
+                if (ranStarved || item.skipped < s_Config.maxSkippedFrames) {
+                    ++item.skipped;
+                    continue;
+                }
+                ranStarved = true;
+                ++s_Stats.forced;
+            }
+
+            Run(candidate.index);
+            ++s_Stats.executed;
+        }
+
+        // Items that ran stay in the pending list until here, so their slots cannot be reused mid-drain
+        f64 deferredCost = 0.0;
+        std::erase_if(s_Pending, [&deferredCost](u32 index) {
+            if (s_Items[index].callback) {
+                deferredCost += s_Kinds[s_Items[index].kind].cost;
+                return false;
+            }
+            Free(index);
+            return true;
+        });
+
+        s_Stats.usedMs = static_cast<f32>((GetTime() - start) * 1000.0);
+        s_Stats.deferred = static_cast<u32>(s_Pending.size());
+        s_Stats.deferredCostMs = static_cast<f32>(deferredCost * 1000.0);
+
+        budgetGauge.Set(s_Stats.budgetMs);
+        usedGauge.Set(s_Stats.usedMs);
+        pendingGauge.Set(static_cast<f64>(s_Stats.deferred));
+        forcedCounter.Increment(s_Stats.forced);
+    }
+
+    u32 DeferredWork::GetKind(std::string_view kind)
+    {
+        auto it = s_KindIndices.find(kind);
+        if (it != s_KindIndices.end()) return it->second;
+
+        const u32 index = static_cast<u32>(s_Kinds.size());
+        s_Kinds.push_back(Kind { std::string(kind), static_cast<f64>(s_Config.defaultCost), 0 });
+        s_KindIndices.emplace(std::string(kind), index);
+
+        return index;
+    }
+
+    void DeferredWork::Run(u32 index)
+    {
+        // The callback may enqueue, which can move s_Items, so nothing refers into it across the call
+        Callback callback = std::move(s_Items[index].callback);
+        s_Items[index].callback = nullptr;
+        s_Items[index].generation++;
+
+        const u32 kind = s_Items[index].kind;
+
+        const f64 start = GetTime();
+        callback();
+        const f64 cost = GetTime() - start;
+
+        // The first run replaces the default guess outright
+        Kind& stats = s_Kinds[kind];
+        const f64 smoothing = static_cast<f64>(s_Config.costSmoothing);
+        stats.cost = stats.runs == 0 ? cost : stats.cost + (cost - stats.cost) * smoothing;
+        stats.runs++;
+    }
+
+    void DeferredWork::Free(u32 index)
+    {
+        Item& item = s_Items[index];
+        if (item.callback) {
+            item.callback = nullptr;
+            item.generation++;
+        }
+
+        s_FreeItems.push_back(index);
+    }
+
+    f64 DeferredWork::GetTime() noexcept
+    {
+        return std::chrono::duration<f64>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+}
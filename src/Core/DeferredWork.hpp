@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Delegate.hpp"
+
+namespace Core {
+
+    enum class WorkPriority : u8
+    {
+        Low,
+        Normal,
+        High
+    };
+
+    struct DeferredWorkHandle
+    {
+        u32 index = std::numeric_limits<u32>::max();
+        u32 generation = 0;
+
+        [[nodiscard]] constexpr bool IsValid() const noexcept
+        {
+            return index != std::numeric_limits<u32>::max();
+        }
+    };
+
+    struct DeferredWorkStats
+    {
+        f32 budgetMs = 0.0f;        // Frame time left when draining started
+        f32 usedMs = 0.0f;
+        u32 executed = 0;
+        u32 forced = 0;             // Of executed, ran over budget because of a deadline or starvation
+        u32 deferred = 0;           // Still queued afterwards
+        f32 deferredCostMs = 0.0f;  // Estimated cost of the queued work
+    };
+
+    struct DeferredWorkConfig
+    {
+        f32 frameBudget = 1.0f / 60.0f;     // Target frame time in seconds, the queue gets what is left of it
+        f32 defaultCost = 0.0005f;          // Estimate in seconds for a kind that never ran
+        f32 costSmoothing = 0.25f;          // Weight of the newest run in the moving average
+        f32 agingRate = 2.0f;               // Priority levels gained per second of waiting
+        u32 maxSkippedFrames = 120;         // An item passed over this often runs even over budget
+    };
+
+    // Non-urgent work that has to run on the main thread. Drained at the end
+    // of each frame, highest priority first, for as long as the remaining
+    // frame budget allows. Items run when their learned cost fits the budget
+    // left, once their deadline has passed, or once they were passed over
+    // maxSkippedFrames times; waiting also raises their priority, so low
+    // priority work still makes progress under load.
+    class DeferredWork
+    {
+        friend class Application;
+    public:
+        using Callback = Delegate<void()>;
+        using Config = DeferredWorkConfig;
+
+    public:
+        // Items of the same kind share a cost estimate, learned from their runs.
+        // A deadline, in seconds from now, forces the item to run once it passes.
+        static DeferredWorkHandle Enqueue(std::string_view kind, Callback callback,
+            WorkPriority priority = WorkPriority::Normal, std::optional<f32> deadline = std::nullopt);
+
+        static bool Cancel(DeferredWorkHandle handle);
+        [[nodiscard]] static bool IsPending(DeferredWorkHandle handle);
+
+        [[nodiscard]] inline static usize GetPendingCount() noexcept { return s_Pending.size(); }
+        [[nodiscard]] inline static const DeferredWorkStats& GetLastFrameStats() noexcept { return s_Stats; }
+
+        // Moving average of past runs in seconds, the default for an unknown kind
+        [[nodiscard]] static f32 GetEstimatedCost(std::string_view kind);
+
+    protected:
+        static void Init(const Config& config);
+        static void Shutdown();
+
+        // Runs work until the frame, frameTime seconds old so far, reaches the
+        // frame budget; overdue and starved items run regardless
+        static void Drain(f32 frameTime);
+
+    private:
+        struct Kind
+        {
+            std::string name;
+            f64 cost = 0.0;
+            u64 runs = 0;
+        };
+
+        struct Item
+        {
+            Callback callback;
+            f64 enqueued = 0.0;
+            f64 deadline = std::numeric_limits<f64>::infinity();
+            u32 kind = 0;
+            u32 generation = 0;
+            u32 skipped = 0;
+            WorkPriority priority = WorkPriority::Normal;
+        };
+
+        struct Candidate
+        {
+            f64 score;
+            u32 index;
+            u32 generation;
+            bool overdue;
+        };
+
+        static u32 GetKind(std::string_view kind);
+        static void Run(u32 index);
+        static void Free(u32 index);
+
+        [[nodiscard]] static f64 GetTime() noexcept;
+
+    private:
+        inline static Config s_Config;
+        inline static DeferredWorkStats s_Stats;
+
+        inline static std::vector<Item> s_Items;
+        inline static std::vector<u32> s_FreeItems;
+        inline static std::vector<u32> s_Pending;
+        inline static std::vector<Candidate> s_Candidates;
+
+        inline static std::vector<Kind> s_Kinds;
+        inline static std::map<std::string, u32, std::less<>> s_KindIndices;
+    };
+
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+namespace Core {
+
+    template <typename Signature, usize Capacity = 32>
+    class Delegate;
+
+    // Move-only callable with fixed inline storage. Never allocates, callables
+    // that do not fit in Capacity bytes are rejected at compile time.
+    template <typename R, typename... Args, usize Capacity>
+    class Delegate<R(Args...), Capacity>
+    {
+    public:
+        constexpr Delegate() noexcept = default;
+        constexpr Delegate(std::nullptr_t) noexcept {}
+
+        template <typename Func>
+            requires (!std::is_same_v<std::remove_cvref_t<Func>, Delegate>)
+                && std::is_invocable_r_v<R, std::decay_t<Func>&, Args...>
+        Delegate(Func&& func) noexcept
+        {
+            using Fn = std::decay_t<Func>;
+
+            static_assert(sizeof(Fn) <= Capacity, "Callable does not fit in the delegate's inline storage");
+            static_assert(alignof(Fn) <= alignof(std::max_align_t), "Callable is over-aligned for the delegate's inline storage");
+            static_assert(std::is_nothrow_move_constructible_v<Fn>, "Callable must be nothrow move constructible");
+
+            std::construct_at(reinterpret_cast<Fn*>(m_Storage), std::forward<Func>(func));
+
+            m_Invoke = [](void* storage, Args... args) -> R {
+                return std::invoke(*static_cast<Fn*>(storage), std::forward<Args>(args)...);
+            };
+
+            if constexpr (!std::is_trivially_copyable_v<Fn> || !std::is_trivially_destructible_v<Fn>) {
+                m_Manage = [](void* dst, void* src) noexcept {
+                    if (dst) {
+                        std::construct_at(static_cast<Fn*>(dst), std::move(*static_cast<Fn*>(src)));
+                    }
+                    std::destroy_at(static_cast<Fn*>(src));
+                };
+            }
+        }
+
+        Delegate(Delegate&& other) noexcept
+        {
+            MoveFrom(other);
+        }
+
+        Delegate& operator=(Delegate&& other) noexcept
+        {
+            if (this != &other) {
+                Reset();
+                MoveFrom(other);
+            }
+            return *this;
+        }
+
+        Delegate& operator=(std::nullptr_t) noexcept
+        {
+            Reset();
+            return *this;
+        }
+
+        Delegate(const Delegate&) = delete;
+        Delegate& operator=(const Delegate&) = delete;
+
+        ~Delegate()
+        {
+            Reset();
+        }
+
+        inline R operator()(Args... args) const
+        {
+            assert(m_Invoke && "Invoking an empty delegate");
+            return m_Invoke(const_cast<std::byte*>(m_Storage), std::forward<Args>(args)...);
+        }
+
+        [[nodiscard]] inline explicit operator bool() const noexcept
+        {
+            return m_Invoke != nullptr;
+        }
+
+        inline void Reset() noexcept
+        {
+            if (m_Manage) {
+                m_Manage(nullptr, m_Storage);
+            }
+
+            m_Invoke = nullptr;
+            m_Manage = nullptr;
+        }
+
+    private:
+        inline void MoveFrom(Delegate& other) noexcept
+        {
+            if (other.m_Manage) {
+                other.m_Manage(m_Storage, other.m_Storage);
+            } else {
+                std::memcpy(m_Storage, other.m_Storage, Capacity);
+            }
+
+            m_Invoke = std::exchange(other.m_Invoke, nullptr);
+            m_Manage = std::exchange(other.m_Manage, nullptr);
+        }
+
+    private:
+        alignas(std::max_align_t) std::byte m_Storage[Capacity];
+
+        R (*m_Invoke)(void*, Args...) = nullptr;
+        void (*m_Manage)(void* dst, void* src) noexcept = nullptr;
+    };
+
+}
@@ -0,0 +1,140 @@
+#include "Archetype.hpp"
+
+namespace Core::ECS {
+
+    namespace {
+
+        constexpr usize AlignUp(usize value, usize alignment) noexcept
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+    }
+
+    Archetype::Archetype(const ComponentMask& mask)
+        : m_Mask(mask)
+    {
+        m_ColumnOf.fill(-1);
+
+        usize rowSize = sizeof(Entity);
+        for (ComponentID id = 0; id < MaxComponents; ++id) {
+            if (!m_Mask.test(id)) continue;
+
+            const ComponentInfo& info = ComponentRegistry::GetInfo(id);
+
+            m_ColumnOf[id] = static_cast<i32>(m_Components.size());
+            m_Components.push_back(id);
+            m_Sizes.push_back(info.size);
+
+            rowSize += info.size;
+        }
+
+        m_Offsets.resize(m_Components.size());
+
+        // Shrink the capacity until every column, padded to its alignment, fits in one chunk
+        u32 capacity = static_cast<u32>(ChunkSize / rowSize);
+        while (capacity > 0) {
+            usize offset = sizeof(Entity) * capacity;
+            for (usize column = 0; column < m_Components.size(); ++column) {
+                offset = AlignUp(offset, ComponentRegistry::GetInfo(m_Components[column]).alignment);
+                m_Offsets[column] = offset;
+                offset += m_Sizes[column] * capacity;
+            }
+
+            if (offset <= ChunkSize) break;
+            --capacity;
+        }
+
+        assert(capacity > 0 && "Archetype row does not fit in a chunk");
+        m_ChunkCapacity = capacity;
+    }
+
+    Archetype::~Archetype()
+    {
+        for (Chunk& chunk : m_Chunks) {
+            for (usize column = 0; column < m_Components.size(); ++column) {
+                const ComponentInfo& info = ComponentRegistry::GetInfo(m_Components[column]);
+                std::byte* data = chunk.data + m_Offsets[column];
+
+                for (u32 row = 0; row < chunk.count; ++row) {
+                    info.destroy(data + row * info.size);
+                }
+            }
+
+            FreeChunk(chunk);
+        }
+    }
+
+    EntityLocation Archetype::Allocate(Entity entity)
+    {
+        if (m_Chunks.empty() || m_Chunks.back().count == m_ChunkCapacity) {
+            AddChunk();
+        }
+
+        const u32 chunkIndex = static_cast<u32>(m_Chunks.size() - 1);
+        Chunk& chunk = m_Chunks.back();
+
+        const u32 row = chunk.count++;
+        reinterpret_cast<Entity*>(chunk.data)[row] = entity;
+
+        return EntityLocation { chunkIndex, row };
+    }
+
+    Entity Archetype::Remove(EntityLocation location, bool destroyComponents)
+    {
+        const u32 lastChunkIndex = static_cast<u32>(m_Chunks.size() - 1);
+        Chunk& lastChunk = m_Chunks[lastChunkIndex];
+        const u32 lastRow = lastChunk.count - 1;
+
+        Chunk& chunk = m_Chunks[location.chunk];
+        const bool isLast = location.chunk == lastChunkIndex && location.row == lastRow;
+
+        Entity moved = NullEntity;
+
+        for (usize column = 0; column < m_Components.size(); ++column) {
+            const ComponentInfo& info = ComponentRegistry::GetInfo(m_Components[column]);
+
+            std::byte* dst = chunk.data + m_Offsets[column] + location.row * info.size;
+            std::byte* src = lastChunk.data + m_Offsets[column] + lastRow * info.size;
+
+            if (destroyComponents) {
+                info.destroy(dst);
+            }
+
+            if (!isLast) {
+                info.moveConstruct(dst, src);
+                info.destroy(src);
+            }
+        }
+
+        if (!isLast) {
+            Entity* entities = reinterpret_cast<Entity*>(chunk.data);
+            entities[location.row] = reinterpret_cast<Entity*>(lastChunk.data)[lastRow];
+            moved = entities[location.row];
+        }
+
+        if (--lastChunk.count == 0) {
+            FreeChunk(lastChunk);
+            m_Chunks.pop_back();
+        }
+
+        return moved;
+    }
+
+    void Archetype::AddChunk()
+    {
+        Chunk chunk;
+        chunk.data = static_cast<std::byte*>(::operator new(ChunkSize, std::align_val_t { ChunkAlignment }));
+        chunk.count = 0;
+
+        m_Chunks.push_back(chunk);
+    }
+
+    void Archetype::FreeChunk(Chunk& chunk)
+    {
+        ::operator delete(chunk.data, std::align_val_t { ChunkAlignment });
+        chunk.data = nullptr;
+        chunk.count = 0;
+    }
+
+}
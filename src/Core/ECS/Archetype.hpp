@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Entity.hpp"
+#include "Component.hpp"
+
+namespace Core::ECS {
+
+    struct Chunk
+    {
+        std::byte* data = nullptr;
+        u32 count = 0;
+    };
+
+    struct EntityLocation
+    {
+        u32 chunk;
+        u32 row;
+    };
+
+    class Archetype
+    {
+    public:
+        Archetype(const ComponentMask& mask);
+        ~Archetype();
+
+        Archetype(const Archetype&) = delete;
+        Archetype& operator=(const Archetype&) = delete;
+
+        [[nodiscard]] inline const ComponentMask& GetMask() const noexcept { return m_Mask; }
+        [[nodiscard]] inline std::span<const ComponentID> GetComponents() const noexcept { return m_Components; }
+        [[nodiscard]] inline u32 GetChunkCapacity() const noexcept { return m_ChunkCapacity; }
+        [[nodiscard]] inline usize GetChunkCount() const noexcept { return m_Chunks.size(); }
+        [[nodiscard]] inline const Chunk& GetChunk(usize index) const noexcept { return m_Chunks[index]; }
+
+        [[nodiscard]] inline bool Has(ComponentID id) const noexcept
+        {
+            return m_Mask.test(id);
+        }
+
+        [[nodiscard]] inline Entity* GetEntities(usize chunk) const noexcept
+        {
+            return reinterpret_cast<Entity*>(m_Chunks[chunk].data);
+        }
+
+        [[nodiscard]] inline void* GetColumn(usize chunk, ComponentID id) const noexcept
+        {
+            const i32 column = m_ColumnOf[id];
+            if (column < 0) return nullptr;
+
+            return m_Chunks[chunk].data + m_Offsets[column];
+        }
+
+        template <typename T>
+        [[nodiscard]] inline T* GetColumn(usize chunk) const noexcept
+        {
+            return static_cast<T*>(GetColumn(chunk, ComponentRegistry::GetID<std::remove_cvref_t<T>>()));
+        }
+
+        [[nodiscard]] inline void* GetComponent(EntityLocation location, ComponentID id) const noexcept
+        {
+            const i32 column = m_ColumnOf[id];
+            if (column < 0) return nullptr;
+
+            return m_Chunks[location.chunk].data + m_Offsets[column] + location.row * m_Sizes[column];
+        }
+
+        // Reserves a row for the entity, component storage is left uninitialized.
+        EntityLocation Allocate(Entity entity);
+
+        // Removes a row by moving the archetype's last row into the hole.
+        // Returns the entity that was relocated, or NullEntity if none moved.
+        Entity Remove(EntityLocation location, bool destroyComponents);
+
+        inline Archetype* GetAddEdge(ComponentID id) const noexcept { return m_AddEdges[id]; }
+        inline Archetype* GetRemoveEdge(ComponentID id) const noexcept { return m_RemoveEdges[id]; }
+        inline void SetAddEdge(ComponentID id, Archetype* archetype) noexcept { m_AddEdges[id] = archetype; }
+        inline void SetRemoveEdge(ComponentID id, Archetype* archetype) noexcept { m_RemoveEdges[id] = archetype; }
+
+    private:
+        void AddChunk();
+        void FreeChunk(Chunk& chunk);
+
+    private:
+        ComponentMask m_Mask;
+        std::vector<ComponentID> m_Components;
+
+        std::array<i32, MaxComponents> m_ColumnOf;
+        std::vector<usize> m_Offsets;
+        std::vector<usize> m_Sizes;
+
+        u32 m_ChunkCapacity = 0;
+        std::vector<Chunk> m_Chunks;
+
+        std::array<Archetype*, MaxComponents> m_AddEdges {};
+        std::array<Archetype*, MaxComponents> m_RemoveEdges {};
+    };
+
+}
@@ -0,0 +1,102 @@
+#include "CommandBuffer.hpp"
+
+#include "World.hpp"
+
+namespace Core::ECS {
+
+    CommandBuffer::~CommandBuffer()
+    {
+        Clear();
+    }
+
+    Entity CommandBuffer::Create()
+    {
+        Entity entity = m_World.Reserve();
+        m_Commands.push_back(Command { CommandType::Create, entity, 0, nullptr });
+
+        return entity;
+    }
+
+    void CommandBuffer::Destroy(Entity entity)
+    {
+        m_Commands.push_back(Command { CommandType::Destroy, entity, 0, nullptr });
+    }
+
+    void CommandBuffer::Flush()
+    {
+        // Commands are swapped out so that anything recorded while flushing lands in the next flush
+        std::vector<Command> commands;
+        std::swap(commands, m_Commands);
+
+        for (Command& command : commands) {
+            switch (command.type) {
+                case CommandType::Create: {
+                    m_World.Materialize(command.entity);
+                } break;
+                case CommandType::Destroy: {
+                    if (m_World.IsAlive(command.entity)) {
+                        m_World.Destroy(command.entity);
+                    }
+                } break;
+                case CommandType::Add: {
+                    if (m_World.IsAlive(command.entity)) {
+                        m_World.AddRaw(command.entity, command.component, command.payload);
+                    }
+                    ComponentRegistry::GetInfo(command.component).destroy(command.payload);
+                    command.payload = nullptr;
+                } break;
+                case CommandType::Remove: {
+                    if (m_World.IsAlive(command.entity)) {
+                        m_World.RemoveRaw(command.entity, command.component);
+                    }
+                } break;
+            }
+        }
+
+        commands.clear();
+        if (m_Commands.empty()) {
+            std::swap(commands, m_Commands);
+            m_PageIndex = 0;
+            m_PageOffset = 0;
+        }
+    }
+
+    void* CommandBuffer::AllocatePayload(usize size, usize alignment)
+    {
+        while (m_PageIndex < m_Pages.size()) {
+            Page& page = m_Pages[m_PageIndex];
+
+            const uintptr_t base = reinterpret_cast<uintptr_t>(page.data.get());
+            const uintptr_t aligned = (base + m_PageOffset + alignment - 1) & ~(alignment - 1);
+
+            if (aligned + size <= base + page.size) {
+                m_PageOffset = (aligned + size) - base;
+                return reinterpret_cast<void*>(aligned);
+            }
+
+            ++m_PageIndex;
+            m_PageOffset = 0;
+        }
+
+        const usize pageSize = std::max(PageSize, size + alignment);
+        m_Pages.push_back(Page { std::make_unique<std::byte[]>(pageSize), pageSize });
+        m_PageIndex = m_Pages.size() - 1;
+        m_PageOffset = 0;
+
+        return AllocatePayload(size, alignment);
+    }
+
+    void CommandBuffer::Clear()
+    {
+        for (Command& command : m_Commands) {
+            if (command.type == CommandType::Add && command.payload) {
+                ComponentRegistry::GetInfo(command.component).destroy(command.payload);
+            }
+        }
+
+        m_Commands.clear();
+        m_PageIndex = 0;
+        m_PageOffset = 0;
+    }
+
+}
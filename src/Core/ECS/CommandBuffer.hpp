@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Entity.hpp"
+#include "Component.hpp"
+
+namespace Core::ECS {
+
+    class World;
+
+    // Records structural changes (create, destroy, add, remove) so they can be
+    // applied between systems instead of invalidating chunks mid-iteration.
+    class CommandBuffer
+    {
+    public:
+        CommandBuffer(World& world) noexcept
+            : m_World(world) {}
+
+        ~CommandBuffer();
+
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        // The returned handle is valid immediately but has no components until the buffer is flushed
+        Entity Create();
+        void Destroy(Entity entity);
+
+        template <IsComponent T>
+        inline void Add(Entity entity, T&& component)
+        {
+            using Type = std::remove_cvref_t<T>;
+
+            void* payload = AllocatePayload(sizeof(Type), alignof(Type));
+            std::construct_at(static_cast<Type*>(payload), std::forward<T>(component));
+
+            m_Commands.push_back(Command { CommandType::Add, entity, ComponentRegistry::GetID<Type>(), payload });
+        }
+
+        template <IsComponent T>
+        inline void Remove(Entity entity)
+        {
+            m_Commands.push_back(Command { CommandType::Remove, entity, ComponentRegistry::GetID<T>(), nullptr });
+        }
+
+        [[nodiscard]] inline bool IsEmpty() const noexcept { return m_Commands.empty(); }
+
+        void Flush();
+
+    private:
+        enum class CommandType : u8
+        {
+            Create,
+            Destroy,
+            Add,
+            Remove
+        };
+
+        struct Command
+        {
+            CommandType type;
+            Entity entity;
+            ComponentID component;
+            void* payload;
+        };
+
+        void* AllocatePayload(usize size, usize alignment);
+        void Clear();
+
+    private:
+        static constexpr usize PageSize = 16 * 1024;
+
+        struct Page
+        {
+            std::unique_ptr<std::byte[]> data;
+            usize size;
+        };
+
+        World& m_World;
+
+        std::vector<Command> m_Commands;
+
+        std::vector<Page> m_Pages;
+        usize m_PageIndex = 0;
+        usize m_PageOffset = 0;
+    };
+
+}
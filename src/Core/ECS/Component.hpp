@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Entity.hpp"
+
+namespace Core::ECS {
+
+    using ComponentID = u32;
+
+    inline constexpr usize MaxComponents = 64;
+    using ComponentMask = std::bitset<MaxComponents>;
+
+    inline constexpr usize ChunkSize = 16 * 1024;
+    inline constexpr usize ChunkAlignment = 64;
+
+    // References and cv-qualifiers are stripped, so lvalues can be passed to Create and CommandBuffer::Add.
+    // Move assignment is needed because World::Add assigns over a component the entity already has.
+    template <typename T>
+    concept IsComponent = std::is_object_v<std::remove_cvref_t<T>>
+        && std::is_nothrow_move_constructible_v<std::remove_cvref_t<T>>
+        && std::is_move_assignable_v<std::remove_cvref_t<T>>
+        && std::is_nothrow_destructible_v<std::remove_cvref_t<T>>;
+
+    struct ComponentInfo
+    {
+        usize size;
+        usize alignment;
+        std::string_view name;
+
+        void (*moveConstruct)(void* dst, void* src) noexcept;
+        void (*destroy)(void* ptr) noexcept;
+    };
+
+    class ComponentRegistry
+    {
+    public:
+        template <IsComponent T>
+        [[nodiscard]] static ComponentID GetID()
+        {
+            if constexpr (!std::is_same_v<T, std::remove_cvref_t<T>>) {
+                return GetID<std::remove_cvref_t<T>>();
+            } else {
+                static const ComponentID id = Register<T>();
+                return id;
+            }
+        }
+
+        [[nodiscard]] static const ComponentInfo& GetInfo(ComponentID id)
+        {
+            return s_Infos[id];
+        }
+
+        [[nodiscard]] static usize GetCount()
+        {
+            return s_Infos.size();
+        }
+
+    private:
+        template <typename T>
+        static ComponentID Register()
+        {
+            static_assert(sizeof(Entity) + sizeof(T) <= ChunkSize, "Component does not fit in a chunk");
+            static_assert(alignof(T) <= ChunkAlignment, "Component alignment exceeds chunk alignment");
+
+            assert(s_Infos.size() < MaxComponents && "Too many component types");
+
+            s_Infos.push_back(ComponentInfo {
+                .size = sizeof(T),
+                .alignment = alignof(T),
+                .name = typeid(T).name(),
+                .moveConstruct = [](void* dst, void* src) noexcept {
+                    std::construct_at(static_cast<T*>(dst), std::move(*static_cast<T*>(src)));
+                },
+                .destroy = [](void* ptr) noexcept {
+                    std::destroy_at(static_cast<T*>(ptr));
+                }
+            });
+
+            return static_cast<ComponentID>(s_Infos.size() - 1);
+        }
+
+    private:
+        inline static std::vector<ComponentInfo> s_Infos;
+    };
+
+    template <typename... Ts>
+    [[nodiscard]] inline ComponentMask MakeComponentMask()
+    {
+        ComponentMask mask;
+        (mask.set(ComponentRegistry::GetID<std::remove_cvref_t<Ts>>()), ...);
+        return mask;
+    }
+
+}
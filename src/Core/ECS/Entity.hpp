@@ -0,0 +1,34 @@
+#pragma once
+
+namespace Core::ECS {
+
+    struct Entity
+    {
+        u32 index = std::numeric_limits<u32>::max();
+        u32 generation = 0;
+
+        [[nodiscard]] constexpr bool IsNull() const noexcept
+        {
+            return index == std::numeric_limits<u32>::max();
+        }
+
+        [[nodiscard]] constexpr u64 GetID() const noexcept
+        {
+            return (static_cast<u64>(generation) << 32) | index;
+        }
+
+        constexpr bool operator==(const Entity&) const noexcept = default;
+    };
+
+    inline constexpr Entity NullEntity {};
+
+}
+
+template <>
+struct std::hash<Core::ECS::Entity>
+{
+    inline usize operator()(const Core::ECS::Entity& entity) const noexcept
+    {
+        return std::hash<u64>{}(entity.GetID());
+    }
+};
@@ -0,0 +1,216 @@
+#include "World.hpp"
+
+namespace Core::ECS {
+
+    World::World()
+        : m_Commands(*this)
+    {
+        m_EmptyArchetype = GetOrCreateArchetype(ComponentMask());
+    }
+
+    Entity World::Create()
+    {
+        assert(m_IterationDepth == 0 && "Structural change during iteration, use GetCommands()");
+
+        const Entity entity = Reserve();
+        Materialize(entity);
+
+        return entity;
+    }
+
+    void World::Destroy(Entity entity)
+    {
+        assert(m_IterationDepth == 0 && "Structural change during iteration, use GetCommands()");
+        assert(IsAlive(entity));
+
+        Record& record = m_Records[entity.index];
+
+        if (record.archetype) {
+            const Entity moved = record.archetype->Remove(record.location, true);
+            if (!moved.IsNull()) {
+                Relocate(moved, record.location);
+            }
+        }
+
+        record.archetype = nullptr;
+        record.generation++;
+
+        m_FreeIndices.push_back(entity.index);
+    }
+
+    void World::AddSystem(std::string_view name, i32 order, SystemFn fn)
+    {
+        // Systems with equal order keep registration order
+        auto it = std::upper_bound(m_Systems.begin(), m_Systems.end(), order, [](i32 value, const System& system) {
+            return value < system.order;
+        });
+
+        m_Systems.insert(it, System { std::string(name), order, std::move(fn) });
+
+        LOG_DEBUG("Registered ECS system \"{}\" (order {})", name, order);
+    }
+
+    void World::Update(f32 deltaTime)
+    {
+        m_Commands.Flush();
+
+        for (System& system : m_Systems) {
+            system.fn(*this, deltaTime);
+
+            if (!m_Commands.IsEmpty()) {
+                m_Commands.Flush();
+            }
+        }
+    }
+
+    Entity World::Reserve()
+    {
+        u32 index;
+        if (!m_FreeIndices.empty()) {
+            index = m_FreeIndices.back();
+            m_FreeIndices.pop_back();
+        } else {
+            index = static_cast<u32>(m_Records.size());
+            m_Records.emplace_back();
+        }
+
+        return Entity { index, m_Records[index].generation };
+    }
+
+    void World::Materialize(Entity entity)
+    {
+        if (!IsAlive(entity)) return;
+
+        Record& record = m_Records[entity.index];
+        if (!record.archetype) {
+            record.archetype = m_EmptyArchetype;
+            record.location = m_EmptyArchetype->Allocate(entity);
+        }
+    }
+
+    void World::AddRaw(Entity entity, ComponentID id, void* component)
+    {
+        const ComponentInfo& info = ComponentRegistry::GetInfo(id);
+        Record& record = m_Records[entity.index];
+
+        if (record.archetype && record.archetype->Has(id)) {
+            void* existing = record.archetype->GetComponent(record.location, id);
+            info.destroy(existing);
+            info.moveConstruct(existing, component);
+            return;
+        }
+
+        MoveEntity(entity, GetAddTarget(record.archetype, id));
+        info.moveConstruct(record.archetype->GetComponent(record.location, id), component);
+    }
+
+    void World::RemoveRaw(Entity entity, ComponentID id)
+    {
+        assert(m_IterationDepth == 0 && "Structural change during iteration, use GetCommands()");
+        assert(IsAlive(entity));
+
+        Record& record = m_Records[entity.index];
+        if (!record.archetype || !record.archetype->Has(id)) return;
+
+        MoveEntity(entity, GetRemoveTarget(record.archetype, id));
+    }
+
+    Archetype* World::GetOrCreateArchetype(const ComponentMask& mask)
+    {
+        auto it = m_ArchetypeMap.find(mask);
+        if (it != m_ArchetypeMap.end()) {
+            return it->second.get();
+        }
+
+        auto archetype = std::make_unique<Archetype>(mask);
+        Archetype* ptr = archetype.get();
+
+        m_ArchetypeMap.emplace(mask, std::move(archetype));
+        m_Archetypes.push_back(ptr);
+
+        return ptr;
+    }
+
+    Archetype* World::GetAddTarget(Archetype* archetype, ComponentID id)
+    {
+        if (!archetype) archetype = m_EmptyArchetype;
+
+        if (Archetype* target = archetype->GetAddEdge(id)) {
+            return target;
+        }
+
+        ComponentMask mask = archetype->GetMask();
+        mask.set(id);
+
+        Archetype* target = GetOrCreateArchetype(mask);
+        archetype->SetAddEdge(id, target);
+        target->SetRemoveEdge(id, archetype);
+
+        return target;
+    }
+
+    Archetype* World::GetRemoveTarget(Archetype* archetype, ComponentID id)
+    {
+        if (Archetype* target = archetype->GetRemoveEdge(id)) {
+            return target;
+        }
+
+        ComponentMask mask = archetype->GetMask();
+        mask.reset(id);
+
+        Archetype* target = GetOrCreateArchetype(mask);
+        archetype->SetRemoveEdge(id, target);
+        target->SetAddEdge(id, archetype);
+
+        return target;
+    }
+
+    void World::MoveEntity(Entity entity, Archetype* target)
+    {
+        Record& record = m_Records[entity.index];
+        Archetype* source = record.archetype;
+
+        const EntityLocation location = target->Allocate(entity);
+
+        if (source) {
+            for (ComponentID id : source->GetComponents()) {
+                if (target->Has(id)) {
+                    ComponentRegistry::GetInfo(id).moveConstruct(
+                        target->GetComponent(location, id),
+                        source->GetComponent(record.location, id)
+                    );
+                }
+            }
+
+            // Moved-from and dropped components are destroyed together with the old row
+            const Entity moved = source->Remove(record.location, true);
+            if (!moved.IsNull()) {
+                Relocate(moved, record.location);
+            }
+        }
+
+        record.archetype = target;
+        record.location = location;
+    }
+
+    void World::Relocate(Entity moved, EntityLocation location)
+    {
+        m_Records[moved.index].location = location;
+    }
+
+    const std::vector<Archetype*>& World::MatchArchetypes(const ComponentMask& mask)
+    {
+        QueryCache& cache = m_Queries[mask];
+
+        // Archetypes are never destroyed, so only the ones created since the last lookup need testing
+        for (; cache.scanned < m_Archetypes.size(); ++cache.scanned) {
+            Archetype* archetype = m_Archetypes[cache.scanned];
+            if ((archetype->GetMask() & mask) == mask) {
+                cache.archetypes.push_back(archetype);
+            }
+        }
+
+        return cache.archetypes;
+    }
+
+}
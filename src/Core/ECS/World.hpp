@@ -0,0 +1,195 @@
+#pragma once
+
+#include "Entity.hpp"
+#include "Component.hpp"
+#include "Archetype.hpp"
+#include "CommandBuffer.hpp"
+
+namespace Core::ECS {
+
+    class World
+    {
+        friend class CommandBuffer;
+    public:
+        using SystemFn = std::function<void(World&, f32)>;
+
+    public:
+        World();
+        ~World() = default;
+
+        World(const World&) = delete;
+        World& operator=(const World&) = delete;
+
+        Entity Create();
+
+        template <IsComponent... Ts>
+        inline Entity Create(Ts&&... components)
+        {
+            assert(m_IterationDepth == 0 && "Structural change during iteration, use GetCommands()");
+
+            const Entity entity = Reserve();
+            Record& record = m_Records[entity.index];
+
+            record.archetype = GetOrCreateArchetype(MakeComponentMask<Ts...>());
+            record.location = record.archetype->Allocate(entity);
+
+            (std::construct_at(
+                static_cast<std::remove_cvref_t<Ts>*>(record.archetype->GetComponent(record.location, ComponentRegistry::GetID<std::remove_cvref_t<Ts>>())),
+                std::forward<Ts>(components)
+            ), ...);
+
+            return entity;
+        }
+
+        void Destroy(Entity entity);
+
+        [[nodiscard]] inline bool IsAlive(Entity entity) const noexcept
+        {
+            return entity.index < m_Records.size() && m_Records[entity.index].generation == entity.generation;
+        }
+
+        template <IsComponent T, typename... Args>
+        inline T& Add(Entity entity, Args&&... args)
+        {
+            assert(m_IterationDepth == 0 && "Structural change during iteration, use GetCommands()");
+            assert(IsAlive(entity));
+
+            const ComponentID id = ComponentRegistry::GetID<T>();
+            Record& record = m_Records[entity.index];
+
+            if (record.archetype && record.archetype->Has(id)) {
+                T* component = static_cast<T*>(record.archetype->GetComponent(record.location, id));
+                *component = T(std::forward<Args>(args)...);
+                return *component;
+            }
+
+            MoveEntity(entity, GetAddTarget(record.archetype, id));
+
+            return *std::construct_at(
+                static_cast<T*>(record.archetype->GetComponent(record.location, id)),
+                std::forward<Args>(args)...
+            );
+        }
+
+        template <IsComponent T>
+        inline void Remove(Entity entity)
+        {
+            RemoveRaw(entity, ComponentRegistry::GetID<T>());
+        }
+
+        template <IsComponent T>
+        [[nodiscard]] inline T* Get(Entity entity) noexcept
+        {
+            if (!IsAlive(entity)) return nullptr;
+
+            const Record& record = m_Records[entity.index];
+            if (!record.archetype) return nullptr;
+
+            return static_cast<T*>(record.archetype->GetComponent(record.location, ComponentRegistry::GetID<T>()));
+        }
+
+        template <IsComponent T>
+        [[nodiscard]] inline bool Has(Entity entity) noexcept
+        {
+            return Get<T>(entity) != nullptr;
+        }
+
+        // Invokes func(Entity, Ts&...) or func(Ts&...) for every entity owning all of Ts
+        template <IsComponent... Ts, typename Func>
+        inline void Each(Func&& func)
+        {
+            EachChunk<Ts...>([&](std::span<const Entity> entities, std::span<Ts>... columns) {
+                for (usize i = 0; i < entities.size(); ++i) {
+                    if constexpr (std::is_invocable_v<Func, Entity, Ts&...>) {
+                        func(entities[i], columns[i]...);
+                    } else {
+                        func(columns[i]...);
+                    }
+                }
+            });
+        }
+
+        // Invokes func(std::span<const Entity>, std::span<Ts>...) once per matching chunk
+        template <IsComponent... Ts, typename Func>
+            requires std::is_invocable_v<Func, std::span<const Entity>, std::span<Ts>...>
+        inline void EachChunk(Func&& func)
+        {
+            const auto& archetypes = MatchArchetypes(MakeComponentMask<Ts...>());
+
+            ++m_IterationDepth;
+            for (Archetype* archetype : archetypes) {
+                for (usize chunk = 0; chunk < archetype->GetChunkCount(); ++chunk) {
+                    const usize count = archetype->GetChunk(chunk).count;
+
+                    func(
+                        std::span<const Entity>(archetype->GetEntities(chunk), count),
+                        std::span<Ts>(archetype->template GetColumn<Ts>(chunk), count)...
+                    );
+                }
+            }
+            --m_IterationDepth;
+        }
+
+        [[nodiscard]] inline CommandBuffer& GetCommands() noexcept { return m_Commands; }
+
+        void AddSystem(std::string_view name, i32 order, SystemFn fn);
+        void Update(f32 deltaTime);
+
+        [[nodiscard]] inline usize GetEntityCount() const noexcept
+        {
+            return m_Records.size() - m_FreeIndices.size();
+        }
+
+    private:
+        struct Record
+        {
+            Archetype* archetype = nullptr;
+            EntityLocation location { 0, 0 };
+            u32 generation = 0;
+        };
+
+        struct QueryCache
+        {
+            std::vector<Archetype*> archetypes;
+            usize scanned = 0;
+        };
+
+        struct System
+        {
+            std::string name;
+            i32 order;
+            SystemFn fn;
+        };
+
+        Entity Reserve();
+        void Materialize(Entity entity);
+
+        void AddRaw(Entity entity, ComponentID id, void* component);
+        void RemoveRaw(Entity entity, ComponentID id);
+
+        Archetype* GetOrCreateArchetype(const ComponentMask& mask);
+        Archetype* GetAddTarget(Archetype* archetype, ComponentID id);
+        Archetype* GetRemoveTarget(Archetype* archetype, ComponentID id);
+
+        void MoveEntity(Entity entity, Archetype* target);
+        void Relocate(Entity moved, EntityLocation location);
+
+        const std::vector<Archetype*>& MatchArchetypes(const ComponentMask& mask);
+
+    private:
+        std::vector<Record> m_Records;
+        std::vector<u32> m_FreeIndices;
+
+        std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> m_ArchetypeMap;
+        std::vector<Archetype*> m_Archetypes;
+        Archetype* m_EmptyArchetype = nullptr;
+
+        std::unordered_map<ComponentMask, QueryCache> m_Queries;
+
+        CommandBuffer m_Commands;
+        std::vector<System> m_Systems;
+
+        u32 m_IterationDepth = 0;
+    };
+
+}
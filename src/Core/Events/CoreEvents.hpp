@@ -118,6 +118,45 @@ namespace Core {
             : MouseEvent(x, y) {}
     };
 
+    struct GamepadEvent : public BaseEvent
+    {
+        u8 gamepad;
+
+    protected:
+        constexpr GamepadEvent(u8 gamepad) noexcept
+            : gamepad(gamepad) {}
+    };
+
+    struct GamepadConnectedEvent final : public GamepadEvent
+    {
+        constexpr GamepadConnectedEvent(u8 gamepad) noexcept
+            : GamepadEvent(gamepad) {}
+    };
+
+    struct GamepadDisconnectedEvent final : public GamepadEvent
+    {
+        constexpr GamepadDisconnectedEvent(u8 gamepad) noexcept
+            : GamepadEvent(gamepad) {}
+    };
+
+    enum class IOOp : u8
+    {
+        Read,
+        Write
+    };
+
+    // Sent from IO::Update. result is the byte count, or a negative errno on failure.
+    struct IOCompletedEvent final : public BaseEvent
+    {
+        IOOp op;
+        u16 buffer;
+        u32 request;
+        i32 result;
+
+        constexpr IOCompletedEvent(u32 request, IOOp op, u16 buffer, i32 result) noexcept
+            : op(op), buffer(buffer), request(request), result(result) {}
+    };
+
     using CoreEvents = EventVariant<
         WindowClosedEvent,
         WindowResizedEvent,
@@ -130,7 +169,21 @@ namespace Core {
         MouseButtonPressedEvent,
         MouseButtonReleasedEvent,
         MouseMovedEvent,
-        MouseScrolledEvent
+        MouseScrolledEvent,
+        GamepadConnectedEvent,
+        GamepadDisconnectedEvent,
+        IOCompletedEvent
     >;
 
+    static_assert(sizeof(CoreEvents) <= 16, "Core events must stay small, send large payloads through the EventChannel");
+
+    // Delivered through the EventChannel, paths are too large for the core queue
+    struct FileDropEvent final : public BaseEvent
+    {
+        std::vector<std::filesystem::path> paths;
+
+        FileDropEvent(std::vector<std::filesystem::path> paths) noexcept
+            : paths(std::move(paths)) {}
+    };
+
 }
@@ -13,6 +13,44 @@ namespace Core {
     template <IsEvent... TEvent>
     using EventVariant = std::variant<TEvent...>;
 
+    template <typename T, typename TEvents>
+    struct EventIndex;
+
+    template <typename T, typename... TEvent>
+    struct EventIndex<T, std::variant<TEvent...>>
+    {
+        static_assert((std::is_same_v<T, TEvent> || ...), "Event type is not an alternative of the event variant");
+
+        static constexpr usize value = [] {
+            constexpr std::array matches { std::is_same_v<T, TEvent>... };
+            return static_cast<usize>(std::ranges::find(matches, true) - matches.begin());
+        }();
+    };
+
+    template <typename T, typename TEvents>
+    inline constexpr usize EventIndexOf = EventIndex<T, TEvents>::value;
+
+    // Shared by the core queue and the event channel so dispatch can interleave
+    // both in the order events were pushed
+    class EventSequence
+    {
+    public:
+        [[nodiscard]] inline static u64 Next() noexcept
+        {
+            return s_Next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+    private:
+        inline static std::atomic<u64> s_Next = 0;
+    };
+
+    template <typename TEvent>
+    struct SequencedEvent
+    {
+        u64 sequence = 0;
+        TEvent event;
+    };
+
     template <typename TEvent>
     class EventDispatcher
     {
@@ -61,16 +99,32 @@ namespace Core {
 
             if (nextTail == m_Head.load(std::memory_order_acquire)) {
                 LOG_ERROR("Event queue full");
+                m_Dropped.fetch_add(1, std::memory_order_relaxed);
                 return;
             }
 
-            m_Buffer[tail] = std::forward<T>(event);
+            m_Buffer[tail].sequence = EventSequence::Next();
+            m_Buffer[tail].event = std::forward<T>(event);
             m_Tail.store(nextTail, std::memory_order_release);
         }
 
-        inline std::vector<TEvent> Poll()
+        // Events Push turned away because the queue was full, since construction
+        [[nodiscard]] inline u64 GetDroppedCount() const noexcept
+        {
+            return m_Dropped.load(std::memory_order_relaxed);
+        }
+
+        // Events that can be pushed before Push starts dropping, exact on the producer thread
+        [[nodiscard]] inline usize GetFreeCount() const noexcept
+        {
+            const usize tail = m_Tail.load(std::memory_order_relaxed);
+            const usize head = m_Head.load(std::memory_order_acquire);
+            return m_QueueSize - 1 - ((tail - head) & (m_QueueSize - 1));
+        }
+
+        inline std::vector<SequencedEvent<TEvent>> Poll()
         {
-            std::vector<TEvent> polled;
+            std::vector<SequencedEvent<TEvent>> polled;
             polled.reserve(m_QueueSize);
 
             auto head = m_Head.load(std::memory_order_relaxed);
@@ -91,7 +145,9 @@ namespace Core {
         alignas(64) std::atomic<usize> m_Tail = 0;
 
         usize m_QueueSize;
-        std::vector<TEvent> m_Buffer;
+        std::vector<SequencedEvent<TEvent>> m_Buffer;
+
+        std::atomic<u64> m_Dropped = 0;
     };
 
 }
@@ -0,0 +1,47 @@
+#include "EventChannel.hpp"
+
+namespace Core {
+
+    std::span<const ChannelEventRef> EventChannel::Collect()
+    {
+        m_Collected.clear();
+
+        {
+            // Storage pointers are stable once created, only the vector itself needs the lock
+            std::scoped_lock lock(m_StorageMutex);
+            for (u32 type = 0; type < m_Storages.size(); ++type) {
+                if (m_Storages[type]) {
+                    m_Storages[type]->Collect(type, m_Collected);
+                }
+            }
+        }
+
+        std::ranges::sort(m_Collected, {}, &ChannelEventRef::sequence);
+
+        return m_Collected;
+    }
+
+    void EventChannel::Dispatch(const ChannelEventRef& ref)
+    {
+        Detail::ChannelStorageBase* storage;
+        {
+            std::scoped_lock lock(m_StorageMutex);
+            storage = m_Storages[ref.type].get();
+        }
+
+        storage->Dispatch(ref.index);
+    }
+
+    void EventChannel::Release()
+    {
+        std::scoped_lock lock(m_StorageMutex);
+        for (auto& storage : m_Storages) {
+            if (storage) {
+                storage->Release();
+            }
+        }
+
+        m_Collected.clear();
+    }
+
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "Event.hpp"
+#include "ListenerList.hpp"
+#include "Core/Delegate.hpp"
+
+namespace Core {
+
+    // One pending channel event, in the order it will be dispatched
+    struct ChannelEventRef
+    {
+        u64 sequence;
+        u32 type;
+        u32 index;
+    };
+
+    namespace Detail {
+
+        class ChannelStorageBase
+        {
+        public:
+            virtual ~ChannelStorageBase() = default;
+
+            virtual void Collect(u32 type, std::vector<ChannelEventRef>& out) = 0;
+            virtual void Dispatch(u32 index) = 0;
+            virtual void Release() = 0;
+        };
+
+        // Events of a single type. Producers append to the pending buffer under a
+        // lock; Collect swaps it with the draining buffer so dispatch runs unlocked
+        // and both buffers keep their capacity from frame to frame.
+        template <IsEvent T>
+        class ChannelStorage final : public ChannelStorageBase
+        {
+        public:
+            using ListenerFn = Delegate<bool(const T&)>;
+
+        public:
+            inline void Push(T&& event, u64 sequence)
+            {
+                std::scoped_lock lock(m_Mutex);
+                m_Pending.push_back(SequencedEvent<T> { sequence, std::move(event) });
+            }
+
+            inline ListenerHandle Subscribe(ListenerFn fn)
+            {
+                return m_Listeners.Add(std::move(fn));
+            }
+
+            inline bool Unsubscribe(ListenerHandle handle)
+            {
+                return m_Listeners.Remove(handle);
+            }
+
+            void Collect(u32 type, std::vector<ChannelEventRef>& out) override
+            {
+                {
+                    std::scoped_lock lock(m_Mutex);
+                    std::swap(m_Pending, m_Draining);
+                }
+
+                for (u32 i = 0; i < m_Draining.size(); ++i) {
+                    out.push_back(ChannelEventRef { m_Draining[i].sequence, type, i });
+                }
+            }
+
+            void Dispatch(u32 index) override
+            {
+                T& event = m_Draining[index].event;
+                if (!event.handled) {
+                    event.handled = m_Listeners.InvokeUntil(std::as_const(event));
+                }
+            }
+
+            void Release() override
+            {
+                m_Draining.clear();
+            }
+
+        private:
+            std::mutex m_Mutex;
+            std::vector<SequencedEvent<T>> m_Pending;
+            std::vector<SequencedEvent<T>> m_Draining;
+
+            ListenerList<ListenerFn> m_Listeners;
+        };
+
+    }
+
+    // Open-ended event channel for types that are not part of CoreEvents. Each
+    // type gets its own storage, so large payloads never grow the core queue,
+    // and every event takes a number from EventSequence so the application can
+    // dispatch both streams in push order.
+    class EventChannel
+    {
+    public:
+        template <IsEvent T>
+        using ListenerFn = typename Detail::ChannelStorage<T>::ListenerFn;
+
+    public:
+        EventChannel() = default;
+
+        EventChannel(const EventChannel&) = delete;
+        EventChannel& operator=(const EventChannel&) = delete;
+
+        // Callable from any thread
+        template <IsEvent T>
+        inline void Push(T&& event)
+        {
+            using Event = std::remove_cvref_t<T>;
+            GetStorage<Event>().Push(Event(std::forward<T>(event)), EventSequence::Next());
+        }
+
+        // Main thread only. Listeners run in registration order until one returns true.
+        template <IsEvent T>
+        inline ListenerHandle Subscribe(ListenerFn<T> fn)
+        {
+            return GetStorage<T>().Subscribe(std::move(fn));
+        }
+
+        template <IsEvent T>
+        inline bool Unsubscribe(ListenerHandle handle)
+        {
+            return GetStorage<T>().Unsubscribe(handle);
+        }
+
+        // Takes everything pushed so far, sorted by sequence. The events stay
+        // valid until Release.
+        std::span<const ChannelEventRef> Collect();
+        void Dispatch(const ChannelEventRef& ref);
+        void Release();
+
+    private:
+        template <IsEvent T>
+        [[nodiscard]] static u32 GetTypeID()
+        {
+            static const u32 id = s_NextTypeID.fetch_add(1, std::memory_order_relaxed);
+            return id;
+        }
+
+        template <IsEvent T>
+        Detail::ChannelStorage<T>& GetStorage()
+        {
+            const u32 id = GetTypeID<T>();
+
+            std::scoped_lock lock(m_StorageMutex);
+            if (id >= m_Storages.size()) {
+                m_Storages.resize(id + 1);
+            }
+
+            auto& storage = m_Storages[id];
+            if (!storage) {
+                storage = std::make_unique<Detail::ChannelStorage<T>>();
+            }
+
+            return static_cast<Detail::ChannelStorage<T>&>(*storage);
+        }
+
+    private:
+        inline static std::atomic<u32> s_NextTypeID = 0;
+
+        std::mutex m_StorageMutex;
+        std::vector<std::unique_ptr<Detail::ChannelStorageBase>> m_Storages;
+
+        std::vector<ChannelEventRef> m_Collected;
+    };
+
+}
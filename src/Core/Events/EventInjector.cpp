@@ -0,0 +1,173 @@
+#include "EventInjector.hpp"
+
+#include "Core/Metrics/Metrics.hpp"
+
+#if defined(__unix__)
+    #include <fcntl.h>
+    #include <signal.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Core {
+
+#if defined(__unix__)
+    namespace {
+
+        // The pid of another running process draining the ring, if any
+        std::optional<u32> FindLiveConsumer(i32 fd)
+        {
+            struct stat info {};
+            if (fstat(fd, &info) != 0 || static_cast<usize>(info.st_size) < InjectionHeaderSize) return std::nullopt;
+
+            void* mapping = mmap(nullptr, InjectionHeaderSize, PROT_READ, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) return std::nullopt;
+
+            InjectionHeader& header = *static_cast<InjectionHeader*>(mapping);
+            const u32 magic = std::atomic_ref(header.magic).load(std::memory_order_acquire);
+            const u32 pid = header.consumerPid;
+            munmap(mapping, InjectionHeaderSize);
+
+            if (magic != InjectionMagic || pid == 0 || pid == static_cast<u32>(getpid())) return std::nullopt;
+
+            // EPERM still means the process exists
+            if (kill(static_cast<pid_t>(pid), 0) != 0 && errno == ESRCH) return std::nullopt;
+
+            return pid;
+        }
+
+    }
+#endif
+
+    void EventInjector::Init(EventQueue<CoreEvents>* queue, const Config& config)
+    {
+        if (!config.enabled || s_Header) return;
+
+#if defined(__unix__)
+        if (queue->GetFreeCount() <= config.queueReserve) {
+            LOG_WARN("Event injection disabled: a queue reserve of {} leaves no room in the core event queue", config.queueReserve);
+            return;
+        }
+
+        s_Config = config;
+        s_Queue = queue;
+        s_Capacity = std::bit_ceil(static_cast<u64>(std::max<u32>(config.capacity, 1)));
+        s_MappingSize = GetInjectionSegmentSize(s_Capacity);
+
+        i32 fd = shm_open(config.segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0 && errno == EEXIST) {
+            fd = shm_open(config.segmentName.c_str(), O_RDWR, 0);
+
+            if (fd >= 0) {
+                if (std::optional<u32> consumer = FindLiveConsumer(fd)) {
+                    LOG_WARN("Event injection disabled: segment \"{}\" is in use by pid {}", config.segmentName, *consumer);
+                    close(fd);
+                    return;
+                }
+            }
+        }
+
+        if (fd < 0) {
+            LOG_WARN("Event injection: shm_open(\"{}\") failed: {}", config.segmentName, std::strerror(errno));
+            return;
+        }
+
+        if (ftruncate(fd, static_cast<off_t>(s_MappingSize)) != 0) {
+            LOG_WARN("Event injection: ftruncate failed: {}", std::strerror(errno));
+            close(fd);
+            return;
+        }
+
+        void* mapping = mmap(nullptr, s_MappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if (mapping == MAP_FAILED) {
+            LOG_WARN("Event injection: mmap failed: {}", std::strerror(errno));
+            return;
+        }
+
+        // Only a segment left by a crashed run gets here; a driver attached to it has to reconnect
+        std::memset(mapping, 0, s_MappingSize);
+
+        s_Header = static_cast<InjectionHeader*>(mapping);
+        s_Records = reinterpret_cast<InjectedEvent*>(static_cast<std::byte*>(mapping) + InjectionHeaderSize);
+
+        s_Header->headerSize = InjectionHeaderSize;
+        s_Header->recordSize = sizeof(InjectedEvent);
+        s_Header->capacity = s_Capacity;
+        s_Header->consumerPid = static_cast<u32>(getpid());
+        s_Header->version = InjectionVersion;
+
+        // Drivers wait for the magic, so it goes last
+        std::atomic_ref(s_Header->magic).store(InjectionMagic, std::memory_order_release);
+
+        LOG_INFO("Event injection: accepting events on shared memory segment \"{}\" ({} records)", config.segmentName, s_Capacity);
+#else
+        (void)queue;
+        LOG_WARN("Event injection is not supported on this platform");
+#endif
+    }
+
+    void EventInjector::Update()
+    {
+        if (!s_Header) return;
+
+        static Metrics::Counter& injected = Metrics::Registry::GetCounter("inject.events");
+        static Metrics::Counter& rejected = Metrics::Registry::GetCounter("inject.rejected");
+        static Metrics::Gauge& backlog = Metrics::Registry::GetGauge("inject.backlog");
+
+        const u64 read = s_Header->readIndex.load(std::memory_order_relaxed);
+        const u64 write = s_Header->writeIndex.load(std::memory_order_acquire);
+
+        // Only a misbehaving producer gets here; drop everything rather than read garbage
+        if (write - read > s_Capacity) {
+            LOG_WARN("Event injection: producer index {} is out of range (read index {}), discarding the ring", write, read);
+            s_Header->readIndex.store(write, std::memory_order_release);
+            return;
+        }
+
+        const usize free = s_Queue->GetFreeCount();
+        const usize room = free > s_Config.queueReserve ? free - s_Config.queueReserve : 0;
+
+        const u64 count = std::min<u64>({ write - read, s_Config.maxPerFrame, room });
+        u64 invalid = 0;
+
+        for (u64 i = 0; i < count; ++i) {
+            std::optional<CoreEvents> event = DecodeInjectedEvent(s_Records[(read + i) & (s_Capacity - 1)]);
+            if (!event) {
+                ++invalid;
+                continue;
+            }
+
+            std::visit([](auto& e) { s_Queue->Push(std::move(e)); }, *event);
+        }
+
+        // Hands the slots back to the producer
+        s_Header->readIndex.store(read + count, std::memory_order_release);
+
+        s_Injected += count - invalid;
+        injected.Increment(count - invalid);
+        rejected.Increment(invalid);
+        backlog.Set(static_cast<f64>(write - read - count));
+
+        if (invalid > 0) {
+            LOG_WARN("Event injection: rejected {} record(s) with an unknown type or out-of-range code", invalid);
+        }
+    }
+
+    void EventInjector::Shutdown()
+    {
+#if defined(__unix__)
+        if (!s_Header) return;
+
+        munmap(s_Header, s_MappingSize);
+        shm_unlink(s_Config.segmentName.c_str());
+
+        s_Header = nullptr;
+        s_Records = nullptr;
+        s_Queue = nullptr;
+#endif
+    }
+
+}
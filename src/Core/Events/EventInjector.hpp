@@ -0,0 +1,49 @@
+#pragma once
+
+#include "InjectionLayout.hpp"
+
+namespace Core {
+
+    struct EventInjectionConfig
+    {
+        bool enabled = false;
+        std::string segmentName = DefaultInjectionSegment;
+        u32 capacity = 16 * 1024;   // Records, rounded up to a power of two
+        u32 maxPerFrame = 512;      // The rest stays in the ring
+        u32 queueReserve = 256;     // Core queue slots left free for window and IO events pushed later in the frame
+    };
+
+    // Feeds events written by another process, normally the EventDriver tool,
+    // into the core event queue. The application creates the shared ring at
+    // Init; every Update moves up to maxPerFrame events into the queue, where
+    // they are dispatched like window events, Input included. An event is only
+    // taken from the ring once the queue has room for it, so a backed-up queue
+    // slows the driver down instead of losing input. Meant for soak and load
+    // tests, disabled by default.
+    class EventInjector
+    {
+        friend class Application;
+    public:
+        using Config = EventInjectionConfig;
+
+        [[nodiscard]] inline static bool IsActive() noexcept { return s_Header != nullptr; }
+        [[nodiscard]] inline static u64 GetInjectedCount() noexcept { return s_Injected; }
+
+    protected:
+        static void Init(EventQueue<CoreEvents>* queue, const Config& config = Config());
+        static void Update();
+        static void Shutdown();
+
+    private:
+        inline static Config s_Config;
+        inline static EventQueue<CoreEvents>* s_Queue = nullptr;
+
+        inline static InjectionHeader* s_Header = nullptr;
+        inline static InjectedEvent* s_Records = nullptr;
+        inline static u64 s_Capacity = 0;
+        inline static usize s_MappingSize = 0;
+
+        inline static u64 s_Injected = 0;
+    };
+
+}
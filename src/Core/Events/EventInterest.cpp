@@ -0,0 +1,52 @@
+#include "EventInterest.hpp"
+
+namespace Core {
+
+    void EventInterest::Add(EventMask mask)
+    {
+        EventMask changed = 0;
+
+        for (EventMask bits = mask & AllCoreEvents; bits; bits &= bits - 1) {
+            const usize index = static_cast<usize>(std::countr_zero(bits));
+            if (s_Counts[index]++ == 0) {
+                changed |= EventMask { 1 } << index;
+            }
+        }
+
+        if (changed) {
+            s_Mask |= changed;
+            s_Listeners.Invoke(s_Mask);
+        }
+    }
+
+    void EventInterest::Remove(EventMask mask)
+    {
+        EventMask changed = 0;
+
+        for (EventMask bits = mask & AllCoreEvents; bits; bits &= bits - 1) {
+            const usize index = static_cast<usize>(std::countr_zero(bits));
+
+            assert(s_Counts[index] > 0 && "Removing event interest that was never added");
+            if (s_Counts[index] > 0 && --s_Counts[index] == 0) {
+                changed |= EventMask { 1 } << index;
+            }
+        }
+
+        if (changed) {
+            s_Mask &= ~changed;
+            s_Listeners.Invoke(s_Mask);
+        }
+    }
+
+    ListenerHandle EventInterest::Subscribe(ChangedFn fn)
+    {
+        fn(s_Mask);
+        return s_Listeners.Add(std::move(fn));
+    }
+
+    bool EventInterest::Unsubscribe(ListenerHandle handle)
+    {
+        return s_Listeners.Remove(handle);
+    }
+
+}
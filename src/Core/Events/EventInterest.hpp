@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreEvents.hpp"
+#include "ListenerList.hpp"
+#include "Core/Delegate.hpp"
+
+namespace Core {
+
+    // One bit per CoreEvents alternative
+    using EventMask = u64;
+
+    static_assert(std::variant_size_v<CoreEvents> <= 64, "EventMask has one bit per core event");
+
+    template <IsEvent... Ts>
+    inline constexpr EventMask EventMaskOf = ((EventMask { 1 } << EventIndexOf<Ts, CoreEvents>) | ... | 0);
+
+    inline constexpr EventMask AllCoreEvents = std::variant_size_v<CoreEvents> == 64
+        ? ~EventMask { 0 }
+        : (EventMask { 1 } << std::variant_size_v<CoreEvents>) - 1;
+
+    // Reference-counted set of core event types somebody is listening for.
+    // Event sources subscribe to changes and only produce what is wanted.
+    // Main thread only.
+    class EventInterest
+    {
+    public:
+        using ChangedFn = Delegate<void(EventMask)>;
+
+    public:
+        static void Add(EventMask mask);
+        static void Remove(EventMask mask);
+
+        [[nodiscard]] inline static EventMask GetMask() noexcept
+        {
+            return s_Mask;
+        }
+
+        // The callback also runs once immediately with the current mask
+        static ListenerHandle Subscribe(ChangedFn fn);
+        static bool Unsubscribe(ListenerHandle handle);
+
+    private:
+        inline static std::array<u32, std::variant_size_v<CoreEvents>> s_Counts {};
+        inline static EventMask s_Mask = 0;
+
+        inline static ListenerList<ChangedFn> s_Listeners;
+    };
+
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "CoreEvents.hpp"
+
+// Shared-memory layout of the event injection ring, filled by the EventDriver
+// tool and drained by EventInjector. The ring is single producer, single
+// consumer. Bump InjectionVersion on any change to these structs or to the
+// meaning of a wire code.
+
+namespace Core {
+
+    inline constexpr u32 InjectionMagic = 0x4A4E4945; // "EINJ"
+    inline constexpr u32 InjectionVersion = 1;
+
+    inline constexpr usize InjectionHeaderSize = 256;
+
+    inline constexpr const char* DefaultInjectionSegment = "/Application.inject";
+
+    // Wire codes are fixed, new events get new codes
+    enum class InjectedEventType : u16
+    {
+        None = 0,
+        WindowClosed = 1,
+        WindowResized = 2,
+        WindowMoved = 3,
+        WindowMinimize = 4,
+        WindowFocus = 5,
+        KeyPressed = 6,
+        KeyReleased = 7,
+        KeyTyped = 8,
+        MouseButtonPressed = 9,
+        MouseButtonReleased = 10,
+        MouseMoved = 11,
+        MouseScrolled = 12,
+        GamepadConnected = 13,
+        GamepadDisconnected = 14
+    };
+
+    inline constexpr u16 InjectedFlagSet = 1 << 0; // repeat, minimized or focused
+
+    struct InjectedEvent
+    {
+        InjectedEventType type;
+        u16 flags;
+
+        // KeyCode or MouseButton (GLFW values), codepoint or gamepad index
+        u32 code;
+
+        // Width and height, x and y as i32, or mouse coordinates as f32 bit patterns
+        u32 a;
+        u32 b;
+    };
+
+    struct InjectionHeader
+    {
+        u32 magic;
+        u32 version;
+        u32 headerSize;
+        u32 recordSize;
+        u64 capacity;       // Power of two; record i lives in slot i & (capacity - 1)
+        u32 consumerPid;
+
+        // Claimed by a driver for as long as it writes, zero when free
+        std::atomic<u32> producerPid;
+
+        // Written only by the producer, read only by the consumer, and the other way round
+        alignas(64) std::atomic<u64> writeIndex;
+        alignas(64) std::atomic<u64> readIndex;
+    };
+
+    static_assert(std::atomic<u64>::is_always_lock_free, "The injection ring requires lock-free 64-bit atomics");
+    static_assert(sizeof(InjectionHeader) <= InjectionHeaderSize);
+    static_assert(sizeof(InjectedEvent) == 16);
+
+    [[nodiscard]] constexpr usize GetInjectionSegmentSize(u64 capacity) noexcept
+    {
+        return InjectionHeaderSize + capacity * sizeof(InjectedEvent);
+    }
+
+    // Events that cannot travel over the wire, like IO completions, give nullopt
+    [[nodiscard]] inline std::optional<InjectedEvent> EncodeInjectedEvent(const CoreEvents& event) noexcept
+    {
+        return std::visit([](const auto& e) -> std::optional<InjectedEvent> {
+            using T = std::remove_cvref_t<decltype(e)>;
+
+            InjectedEvent wire {};
+
+            if constexpr (std::is_same_v<T, WindowClosedEvent>) {
+                wire.type = InjectedEventType::WindowClosed;
+            } else if constexpr (std::is_same_v<T, WindowResizedEvent>) {
+                wire = { InjectedEventType::WindowResized, 0, 0, e.width, e.height };
+            } else if constexpr (std::is_same_v<T, WindowMovedEvent>) {
+                wire = { InjectedEventType::WindowMoved, 0, 0, std::bit_cast<u32>(e.x), std::bit_cast<u32>(e.y) };
+            } else if constexpr (std::is_same_v<T, WindowMinimizeEvent>) {
+                wire = { InjectedEventType::WindowMinimize, e.minimized ? InjectedFlagSet : u16(0), 0, 0, 0 };
+            } else if constexpr (std::is_same_v<T, WindowFocusEvent>) {
+                wire = { InjectedEventType::WindowFocus, e.focused ? InjectedFlagSet : u16(0), 0, 0, 0 };
+            } else if constexpr (std::is_same_v<T, KeyPressedEvent>) {
+                wire = { InjectedEventType::KeyPressed, e.repeat ? InjectedFlagSet : u16(0), static_cast<u32>(e.keycode), 0, 0 };
+            } else if constexpr (std::is_same_v<T, KeyReleasedEvent>) {
+                wire = { InjectedEventType::KeyReleased, 0, static_cast<u32>(e.keycode), 0, 0 };
+            } else if constexpr (std::is_same_v<T, KeyTypedEvent>) {
+                wire = { InjectedEventType::KeyTyped, 0, e.codepoint, 0, 0 };
+            } else if constexpr (std::is_same_v<T, MouseButtonPressedEvent>) {
+                wire = { InjectedEventType::MouseButtonPressed, 0, static_cast<u32>(e.button), 0, 0 };
+            } else if constexpr (std::is_same_v<T, MouseButtonReleasedEvent>) {
+                wire = { InjectedEventType::MouseButtonReleased, 0, static_cast<u32>(e.button), 0, 0 };
+            } else if constexpr (std::is_same_v<T, MouseMovedEvent>) {
+                wire = { InjectedEventType::MouseMoved, 0, 0, std::bit_cast<u32>(e.x), std::bit_cast<u32>(e.y) };
+            } else if constexpr (std::is_same_v<T, MouseScrolledEvent>) {
+                wire = { InjectedEventType::MouseScrolled, 0, 0, std::bit_cast<u32>(e.x), std::bit_cast<u32>(e.y) };
+            } else if constexpr (std::is_same_v<T, GamepadConnectedEvent>) {
+                wire = { InjectedEventType::GamepadConnected, 0, e.gamepad, 0, 0 };
+            } else if constexpr (std::is_same_v<T, GamepadDisconnectedEvent>) {
+                wire = { InjectedEventType::GamepadDisconnected, 0, e.gamepad, 0, 0 };
+            } else {
+                return std::nullopt;
+            }
+
+            return wire;
+        }, event);
+    }
+
+    // Unknown types and out-of-range codes give nullopt
+    [[nodiscard]] inline std::optional<CoreEvents> DecodeInjectedEvent(const InjectedEvent& wire) noexcept
+    {
+        const bool set = (wire.flags & InjectedFlagSet) != 0;
+
+        const auto keycode = [&]() -> std::optional<KeyCode> {
+            if (wire.code > static_cast<u32>(KeyCode::Menu)) return std::nullopt;
+            return static_cast<KeyCode>(wire.code);
+        };
+
+        const auto button = [&]() -> std::optional<MouseButton> {
+            if (wire.code > static_cast<u32>(MouseButton::Button5)) return std::nullopt;
+            return static_cast<MouseButton>(wire.code);
+        };
+
+        switch (wire.type) {
+            case InjectedEventType::WindowClosed:
+                return WindowClosedEvent();
+            case InjectedEventType::WindowResized:
+                return WindowResizedEvent(wire.a, wire.b);
+            case InjectedEventType::WindowMoved:
+                return WindowMovedEvent(std::bit_cast<i32>(wire.a), std::bit_cast<i32>(wire.b));
+            case InjectedEventType::WindowMinimize:
+                return WindowMinimizeEvent(set);
+            case InjectedEventType::WindowFocus:
+                return WindowFocusEvent(set);
+            case InjectedEventType::KeyPressed:
+                if (auto key = keycode()) return KeyPressedEvent(*key, set);
+                return std::nullopt;
+            case InjectedEventType::KeyReleased:
+                if (auto key = keycode()) return KeyReleasedEvent(*key);
+                return std::nullopt;
+            case InjectedEventType::KeyTyped:
+                return KeyTypedEvent(wire.code);
+            case InjectedEventType::MouseButtonPressed:
+                if (auto b = button()) return MouseButtonPressedEvent(*b);
+                return std::nullopt;
+            case InjectedEventType::MouseButtonReleased:
+                if (auto b = button()) return MouseButtonReleasedEvent(*b);
+                return std::nullopt;
+            case InjectedEventType::MouseMoved:
+                return MouseMovedEvent(std::bit_cast<f32>(wire.a), std::bit_cast<f32>(wire.b));
+            case InjectedEventType::MouseScrolled:
+                return MouseScrolledEvent(std::bit_cast<f32>(wire.a), std::bit_cast<f32>(wire.b));
+            case InjectedEventType::GamepadConnected:
+                if (wire.code <= std::numeric_limits<u8>::max()) return GamepadConnectedEvent(static_cast<u8>(wire.code));
+                return std::nullopt;
+            case InjectedEventType::GamepadDisconnected:
+                if (wire.code <= std::numeric_limits<u8>::max()) return GamepadDisconnectedEvent(static_cast<u8>(wire.code));
+                return std::nullopt;
+            default:
+                return std::nullopt;
+        }
+    }
+
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+namespace Core {
+
+    struct ListenerHandle
+    {
+        u32 index = std::numeric_limits<u32>::max();
+        u32 generation = 0;
+
+        [[nodiscard]] constexpr bool IsValid() const noexcept
+        {
+            return index != std::numeric_limits<u32>::max();
+        }
+    };
+
+    // Ordered set of listeners with O(1) removal through generational handles.
+    // Listeners may add or remove any listener, including themselves, while the
+    // list is being invoked: removed slots are only recycled once dispatch ends,
+    // and listeners added mid-dispatch are first called on the next Invoke.
+    template <typename Fn>
+    class ListenerList
+    {
+    public:
+        ListenerHandle Add(Fn&& fn)
+        {
+            u32 index;
+            if (!m_FreeSlots.empty()) {
+                index = m_FreeSlots.back();
+                m_FreeSlots.pop_back();
+            } else {
+                index = static_cast<u32>(m_Slots.size());
+                m_Slots.emplace_back();
+            }
+
+            Slot& slot = m_Slots[index];
+            slot.fn = std::move(fn);
+            slot.active = true;
+            slot.epoch = m_DispatchDepth > 0 ? m_Epoch + 1 : m_Epoch;
+            slot.prev = m_Tail;
+            slot.next = InvalidIndex;
+
+            if (m_Tail != InvalidIndex) {
+                m_Slots[m_Tail].next = index;
+            } else {
+                m_Head = index;
+            }
+            m_Tail = index;
+
+            ++m_Count;
+
+            return ListenerHandle { index, slot.generation };
+        }
+
+        bool Remove(ListenerHandle handle)
+        {
+            if (handle.index >= m_Slots.size()) return false;
+
+            Slot& slot = m_Slots[handle.index];
+            if (!slot.active || slot.generation != handle.generation) return false;
+
+            slot.active = false;
+            slot.generation++;
+
+            // Unlink from neighbours, but keep our own links intact so an
+            // in-flight Invoke standing on this slot can still advance
+            if (slot.prev != InvalidIndex) m_Slots[slot.prev].next = slot.next;
+            else m_Head = slot.next;
+
+            if (slot.next != InvalidIndex) m_Slots[slot.next].prev = slot.prev;
+            else m_Tail = slot.prev;
+
+            --m_Count;
+
+            if (m_DispatchDepth > 0) {
+                m_PendingFree.push_back(handle.index);
+            } else {
+                Release(handle.index);
+            }
+
+            return true;
+        }
+
+        template <typename... Args>
+        void Invoke(Args&&... args)
+        {
+            InvokeImpl<false>(args...);
+        }
+
+        // Stops at the first listener that returns true, and reports whether one did
+        template <typename... Args>
+        bool InvokeUntil(Args&&... args)
+        {
+            return InvokeImpl<true>(args...);
+        }
+
+        [[nodiscard]] inline usize GetCount() const noexcept { return m_Count; }
+
+    private:
+        static constexpr u32 InvalidIndex = std::numeric_limits<u32>::max();
+
+        struct Slot
+        {
+            Fn fn;
+            u32 generation = 0;
+            u32 epoch = 0;
+            u32 prev = InvalidIndex;
+            u32 next = InvalidIndex;
+            bool active = false;
+        };
+
+        template <bool StopOnTrue, typename... Args>
+        bool InvokeImpl(Args&... args)
+        {
+            if (m_DispatchDepth++ == 0) {
+                ++m_Epoch;
+            }
+
+            const u32 epoch = m_Epoch;
+            bool stopped = false;
+
+            u32 index = m_Head;
+            while (index != InvalidIndex) {
+                Slot& slot = m_Slots[index];
+
+                if (slot.active && slot.epoch <= epoch) {
+                    if constexpr (StopOnTrue) {
+                        if (slot.fn(args...)) {
+                            stopped = true;
+                            break;
+                        }
+                    } else {
+                        slot.fn(args...);
+                    }
+                }
+
+                index = slot.next;
+            }
+
+            if (--m_DispatchDepth == 0) {
+                for (u32 pending : m_PendingFree) {
+                    Release(pending);
+                }
+                m_PendingFree.clear();
+            }
+
+            return stopped;
+        }
+
+        inline void Release(u32 index)
+        {
+            m_Slots[index].fn = nullptr;
+            m_FreeSlots.push_back(index);
+        }
+
+    private:
+        // std::deque keeps slot addresses stable while listeners are added mid-dispatch
+        std::deque<Slot> m_Slots;
+        std::vector<u32> m_FreeSlots;
+        std::vector<u32> m_PendingFree;
+
+        u32 m_Head = InvalidIndex;
+        u32 m_Tail = InvalidIndex;
+
+        u32 m_DispatchDepth = 0;
+        u32 m_Epoch = 0;
+        usize m_Count = 0;
+    };
+
+}
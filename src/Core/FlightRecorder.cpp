@@ -0,0 +1,423 @@
+#include "FlightRecorder.hpp"
+
+#if defined(__unix__)
+    #include <cxxabi.h>
+    #include <execinfo.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace Core {
+
+    namespace {
+
+        // Minimal formatting on top of write(2); nothing here allocates or locks
+        class SignalSafeWriter
+        {
+        public:
+            SignalSafeWriter(i32 fd) noexcept
+                : m_Fd(fd) {}
+
+            ~SignalSafeWriter()
+            {
+                Flush();
+            }
+
+            void Write(const char* data, usize length) noexcept
+            {
+                while (length > 0) {
+                    if (m_Used == sizeof(m_Buffer)) Flush();
+
+                    const usize chunk = std::min(length, sizeof(m_Buffer) - m_Used);
+                    std::memcpy(m_Buffer + m_Used, data, chunk);
+
+                    m_Used += chunk;
+                    data += chunk;
+                    length -= chunk;
+                }
+            }
+
+            void Write(const char* text) noexcept
+            {
+                Write(text, std::strlen(text));
+            }
+
+            void Write(std::string_view text) noexcept
+            {
+                Write(text.data(), text.size());
+            }
+
+            void WriteU64(u64 value) noexcept
+            {
+                char digits[20];
+                usize count = 0;
+
+                do {
+                    digits[count++] = static_cast<char>('0' + value % 10);
+                    value /= 10;
+                } while (value > 0);
+
+                while (count > 0) {
+                    Write(&digits[--count], 1);
+                }
+            }
+
+            void WriteI64(i64 value) noexcept
+            {
+                if (value < 0) {
+                    Write("-", 1);
+                    WriteU64(static_cast<u64>(-(value + 1)) + 1);
+                } else {
+                    WriteU64(static_cast<u64>(value));
+                }
+            }
+
+            // Fixed point with three decimals, enough for frame times in milliseconds
+            void WriteF32(f32 value) noexcept
+            {
+                if (!(value == value)) {
+                    Write("nan");
+                    return;
+                }
+
+                if (value < 0.0f) {
+                    Write("-", 1);
+                    value = -value;
+                }
+
+                const u64 scaled = static_cast<u64>(static_cast<f64>(value) * 1000.0 + 0.5);
+                WriteU64(scaled / 1000);
+                Write(".", 1);
+
+                const u64 fraction = scaled % 1000;
+                if (fraction < 100) Write("0", 1);
+                if (fraction < 10) Write("0", 1);
+                WriteU64(fraction);
+            }
+
+            void WriteHex(const std::byte* data, usize size) noexcept
+            {
+                constexpr char Digits[] = "0123456789abcdef";
+
+                for (usize i = 0; i < size; ++i) {
+                    const u8 byte = static_cast<u8>(data[i]);
+                    const char pair[2] = { Digits[byte >> 4], Digits[byte & 0xF] };
+                    Write(pair, 2);
+                }
+            }
+
+            void Flush() noexcept
+            {
+#if defined(__unix__)
+                usize offset = 0;
+                while (offset < m_Used) {
+                    const ssize_t written = ::write(m_Fd, m_Buffer + offset, m_Used - offset);
+                    if (written <= 0) break;
+                    offset += static_cast<usize>(written);
+                }
+#else
+                std::fwrite(m_Buffer, 1, m_Used, m_Fd == 2 ? stderr : stdout);
+#endif
+                m_Used = 0;
+            }
+
+        private:
+            i32 m_Fd;
+            char m_Buffer[1024];
+            usize m_Used = 0;
+        };
+
+        template <typename T>
+        std::string GetTypeName()
+        {
+            const char* mangled = typeid(T).name();
+#if defined(__unix__)
+            i32 status = 0;
+            char* demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+            if (status == 0 && demangled) {
+                std::string name(demangled);
+                std::free(demangled);
+                return name;
+            }
+#endif
+            return mangled;
+        }
+
+        constexpr std::array FatalSignals {
+            SIGSEGV,
+            SIGABRT,
+            SIGBUS,
+            SIGFPE,
+            SIGILL
+        };
+
+        // Handlers that were in place before Install, put back by Uninstall
+#if defined(__unix__)
+        std::array<struct sigaction, FatalSignals.size()> previousActions {};
+#else
+        std::array<void (*)(i32), FatalSignals.size()> previousHandlers {};
+#endif
+
+#if defined(__unix__)
+        constexpr usize AlternateStackSize = 64 * 1024;
+
+        // Each thread needs its own; it is disabled and freed when the thread exits
+        struct AlternateStack
+        {
+            std::unique_ptr<std::byte[]> memory;
+
+            ~AlternateStack()
+            {
+                if (!memory) return;
+
+                stack_t disable {};
+                disable.ss_flags = SS_DISABLE;
+                sigaltstack(&disable, nullptr);
+            }
+        };
+
+        thread_local AlternateStack t_AlternateStack;
+#endif
+
+        const char* GetSignalName(i32 signal) noexcept
+        {
+            switch (signal) {
+                case SIGSEGV: return "SIGSEGV";
+                case SIGABRT: return "SIGABRT";
+                case SIGBUS: return "SIGBUS";
+                case SIGFPE: return "SIGFPE";
+                case SIGILL: return "SIGILL";
+                default: return "signal";
+            }
+        }
+
+    }
+
+    void FlightRecorder::Install()
+    {
+        if (s_Installed) return;
+
+        [&]<usize... I>(std::index_sequence<I...>) {
+            ((s_EventNames[I] = GetTypeName<std::variant_alternative_t<I, CoreEvents>>()), ...);
+        }(std::make_index_sequence<std::variant_size_v<CoreEvents>>());
+
+        const std::string path = std::format("logs/Crash-{}.log", static_cast<u64>(
+#if defined(__unix__)
+            getpid()
+#else
+            0
+#endif
+        ));
+        std::strncpy(s_DumpPath, path.c_str(), sizeof(s_DumpPath) - 1);
+
+#if defined(__unix__)
+        // backtrace() loads libgcc lazily; do it now rather than inside a signal handler
+        void* warmup[1];
+        backtrace(warmup, 1);
+
+        InstallAlternateStack();
+
+        struct sigaction action {};
+        action.sa_handler = &FlightRecorder::OnSignal;
+        action.sa_flags = SA_ONSTACK | SA_RESETHAND;
+        sigemptyset(&action.sa_mask);
+
+        for (usize i = 0; i < FatalSignals.size(); ++i) {
+            sigaction(FatalSignals[i], &action, &previousActions[i]);
+        }
+#else
+        for (usize i = 0; i < FatalSignals.size(); ++i) {
+            previousHandlers[i] = std::signal(FatalSignals[i], &FlightRecorder::OnSignal);
+        }
+#endif
+
+        s_PreviousTerminate = std::set_terminate(&FlightRecorder::OnTerminate);
+        s_Installed = true;
+
+        LOG_DEBUG("Flight recorder installed, crash dumps go to {}", s_DumpPath);
+    }
+
+    void FlightRecorder::Uninstall()
+    {
+        if (!s_Installed) return;
+
+#if defined(__unix__)
+        for (usize i = 0; i < FatalSignals.size(); ++i) {
+            sigaction(FatalSignals[i], &previousActions[i], nullptr);
+        }
+#else
+        for (usize i = 0; i < FatalSignals.size(); ++i) {
+            std::signal(FatalSignals[i], previousHandlers[i] != SIG_ERR ? previousHandlers[i] : SIG_DFL);
+        }
+#endif
+
+        std::set_terminate(s_PreviousTerminate);
+        s_Installed = false;
+    }
+
+    void FlightRecorder::InstallAlternateStack()
+    {
+#if defined(__unix__)
+        if (t_AlternateStack.memory) return;
+
+        // A separate stack lets the handler run after a stack overflow
+        auto memory = std::make_unique<std::byte[]>(AlternateStackSize);
+
+        stack_t stack {};
+        stack.ss_sp = memory.get();
+        stack.ss_size = AlternateStackSize;
+
+        if (sigaltstack(&stack, nullptr) != 0) {
+            LOG_WARN("Flight recorder: sigaltstack failed, a stack overflow on this thread will not be reported: {}", std::strerror(errno));
+            return;
+        }
+
+        t_AlternateStack.memory = std::move(memory);
+#endif
+    }
+
+    void FlightRecorder::RecordFrame(f32 deltaTime, f32 scaledDeltaTime) noexcept
+    {
+        const u64 frame = s_Frame.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        s_Frames.Record(FrameRecord {
+            .frame = frame,
+            .timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()
+            ).count(),
+            .deltaTime = deltaTime,
+            .scaledDeltaTime = scaledDeltaTime
+        });
+    }
+
+    void FlightRecorder::RecordEvent(const CoreEvents& event) noexcept
+    {
+        EventRecord record {};
+        record.frame = GetFrame();
+        record.type = static_cast<u32>(event.index());
+
+        std::visit([&](const auto& e) {
+            using T = std::remove_cvref_t<decltype(e)>;
+            static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(record.payload));
+
+            record.size = sizeof(T);
+            std::memcpy(record.payload, &e, sizeof(T));
+        }, event);
+
+        s_Events.Record(record);
+    }
+
+    void FlightRecorder::RecordLog(std::string_view line) noexcept
+    {
+        while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) {
+            line.remove_suffix(1);
+        }
+
+        LogRecord record;
+        record.frame = GetFrame();
+        record.length = static_cast<u16>(std::min(line.size(), LogLineLength));
+        std::memcpy(record.text, line.data(), record.length);
+
+        s_Logs.Record(record);
+    }
+
+    void FlightRecorder::Dump(const char* reason, bool fromSignal) noexcept
+    {
+        // Only the first fatal path writes a report; abort() from the terminate handler lands here again
+        if (s_Dumping.exchange(true)) return;
+
+#if defined(__unix__)
+        const i32 fd = ::open(s_DumpPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        SignalSafeWriter out(fd >= 0 ? fd : 2);
+#else
+        SignalSafeWriter out(2);
+#endif
+
+        out.Write("==== Flight recorder: ");
+        out.Write(reason);
+        out.Write(" at frame ");
+        out.WriteU64(GetFrame());
+        out.Write(" ====\n\n");
+
+        out.Write("-- Stack trace --\n");
+#if defined(__unix__)
+        if (fromSignal) {
+            void* frames[64];
+            const i32 count = backtrace(frames, 64);
+
+            out.Flush();
+            backtrace_symbols_fd(frames, count, fd >= 0 ? fd : 2);
+        }
+#endif
+        if (!fromSignal) {
+            // Outside a signal handler we can afford a symbolized std::stacktrace
+            out.Write(std::to_string(std::stacktrace::current(1)));
+            out.Write("\n");
+        }
+
+        out.Write("\n-- Last frames (frame, delta ms, scaled delta ms) --\n");
+        s_Frames.ForEach([&](const FrameRecord& record) {
+            out.WriteU64(record.frame);
+            out.Write(" ");
+            out.WriteF32(record.deltaTime * 1000.0f);
+            out.Write(" ");
+            out.WriteF32(record.scaledDeltaTime * 1000.0f);
+            out.Write("\n");
+        });
+
+        out.Write("\n-- Last events (frame, type, payload) --\n");
+        s_Events.ForEach([&](const EventRecord& record) {
+            out.WriteU64(record.frame);
+            out.Write(" ");
+            if (record.type < s_EventNames.size()) {
+                out.Write(s_EventNames[record.type]);
+            } else {
+                out.WriteU64(record.type);
+            }
+            out.Write(" ");
+            out.WriteHex(record.payload, std::min<usize>(record.size, sizeof(record.payload)));
+            out.Write("\n");
+        });
+
+        out.Write("\n-- Last log lines --\n");
+        s_Logs.ForEach([&](const LogRecord& record) {
+            out.Write("[frame ");
+            out.WriteU64(record.frame);
+            out.Write("] ");
+            out.Write(record.text, std::min<usize>(record.length, LogLineLength));
+            out.Write("\n");
+        });
+
+        out.Flush();
+
+#if defined(__unix__)
+        if (fd >= 0) {
+            ::close(fd);
+
+            SignalSafeWriter err(2);
+            err.Write("Crash report written to ");
+            err.Write(s_DumpPath);
+            err.Write("\n");
+        }
+#endif
+    }
+
+    void FlightRecorder::OnSignal(i32 signal)
+    {
+        Dump(GetSignalName(signal), true);
+
+        // SA_RESETHAND restored the default action, re-raise to terminate with the original signal
+        std::raise(signal);
+    }
+
+    void FlightRecorder::OnTerminate()
+    {
+        Dump("std::terminate", false);
+
+        if (s_PreviousTerminate) {
+            s_PreviousTerminate();
+        }
+        std::abort();
+    }
+
+}
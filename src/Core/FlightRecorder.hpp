@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Events/CoreEvents.hpp"
+
+#include <spdlog/sinks/base_sink.h>
+
+namespace Core {
+
+    // Fixed-size ring that any thread can append to without locks. A slot's
+    // sequence is published last so a reader can tell complete entries apart.
+    template <typename T, usize Capacity>
+        requires std::is_trivially_copyable_v<T> && (std::has_single_bit(Capacity))
+    class FlightRing
+    {
+    public:
+        inline void Record(const T& value) noexcept
+        {
+            const u64 index = m_Head.fetch_add(1, std::memory_order_relaxed);
+            Slot& slot = m_Slots[index & (Capacity - 1)];
+
+            // Invalidate the slot while it is rewritten so readers never pair an old sequence with a new value
+            slot.sequence.store(0, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.value = value;
+            slot.sequence.store(index + 1, std::memory_order_release);
+        }
+
+        // Visits the surviving entries oldest first. Only touches plain memory, safe inside a signal handler.
+        template <typename Func>
+        inline void ForEach(Func&& func) const noexcept
+        {
+            const u64 head = m_Head.load(std::memory_order_acquire);
+            const u64 begin = head > Capacity ? head - Capacity : 0;
+
+            for (u64 index = begin; index < head; ++index) {
+                const Slot& slot = m_Slots[index & (Capacity - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) != index + 1) continue;
+
+                const T value = slot.value;
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                // Drop the entry if a writer reclaimed the slot while we copied it
+                if (slot.sequence.load(std::memory_order_relaxed) != index + 1) continue;
+
+                func(value);
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            std::atomic<u64> sequence = 0;
+            T value {};
+        };
+
+        std::array<Slot, Capacity> m_Slots {};
+        alignas(64) std::atomic<u64> m_Head = 0;
+    };
+
+    // Always-on record of the last events, frames and log lines. On a fatal
+    // signal or std::terminate the rings are dumped, together with a stack
+    // trace, to logs/Crash-<pid>.log. A stack overflow is only reported on
+    // threads that called InstallAlternateStack; Install covers the calling thread.
+    class FlightRecorder
+    {
+    public:
+        static constexpr usize EventCapacity = 256;
+        static constexpr usize FrameCapacity = 256;
+        static constexpr usize LogCapacity = 128;
+        static constexpr usize LogLineLength = 160;
+
+    public:
+        static void Install();
+        static void Uninstall();
+
+        // Gives the calling thread its own signal stack, so the crash handler can run after a stack overflow
+        static void InstallAlternateStack();
+
+        static void RecordFrame(f32 deltaTime, f32 scaledDeltaTime) noexcept;
+        static void RecordEvent(const CoreEvents& event) noexcept;
+        static void RecordLog(std::string_view line) noexcept;
+
+        [[nodiscard]] inline static u64 GetFrame() noexcept
+        {
+            return s_Frame.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct FrameRecord
+        {
+            u64 frame;
+            i64 timestampNs;
+            f32 deltaTime;
+            f32 scaledDeltaTime;
+        };
+
+        struct EventRecord
+        {
+            u64 frame;
+            u32 type;
+            u32 size;
+            std::byte payload[24];
+        };
+
+        struct LogRecord
+        {
+            u64 frame;
+            u16 length;
+            char text[LogLineLength];
+        };
+
+        static void Dump(const char* reason, bool fromSignal) noexcept;
+        static void OnSignal(i32 signal);
+        static void OnTerminate();
+
+    private:
+        inline static FlightRing<FrameRecord, FrameCapacity> s_Frames;
+        inline static FlightRing<EventRecord, EventCapacity> s_Events;
+        inline static FlightRing<LogRecord, LogCapacity> s_Logs;
+
+        inline static std::atomic<u64> s_Frame = 0;
+        inline static std::atomic<bool> s_Dumping = false;
+        inline static bool s_Installed = false;
+
+        inline static char s_DumpPath[256] {};
+        inline static std::array<std::string, std::variant_size_v<CoreEvents>> s_EventNames;
+        inline static std::terminate_handler s_PreviousTerminate = nullptr;
+    };
+
+    class FlightRecorderSink final : public spdlog::sinks::base_sink<std::mutex>
+    {
+    protected:
+        void sink_it_(const spdlog::details::log_msg& msg) override
+        {
+            spdlog::memory_buf_t formatted;
+            formatter_->format(msg, formatted);
+
+            FlightRecorder::RecordLog(std::string_view(formatted.data(), formatted.size()));
+        }
+
+        void flush_() override {}
+    };
+
+}
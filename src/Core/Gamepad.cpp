@@ -0,0 +1,163 @@
+#include "Gamepad.hpp"
+
+#include <GLFW/glfw3.h>
+
+namespace Core {
+
+    static_assert(Gamepad::MaxGamepads == GLFW_JOYSTICK_LAST + 1);
+    static_assert(Gamepad::ButtonCount == GLFW_GAMEPAD_BUTTON_LAST + 1);
+    static_assert(Gamepad::AxisCount == GLFW_GAMEPAD_AXIS_LAST + 1);
+    static_assert(Gamepad::ButtonCount <= 16, "Button state is stored as a u16 mask");
+
+    std::string_view Gamepad::GetName(u8 gamepad)
+    {
+        if (!IsConnected(gamepad)) return {};
+
+        const char* name = glfwGetGamepadName(gamepad);
+        return name ? std::string_view(name) : std::string_view();
+    }
+
+    void Gamepad::SetDeadZones(f32 stick, f32 trigger)
+    {
+        s_StickDeadZone = std::clamp(stick, 0.0f, 0.95f);
+        s_TriggerDeadZone = std::clamp(trigger, 0.0f, 0.95f);
+    }
+
+    void Gamepad::Init(EventQueue<CoreEvents>* queue)
+    {
+        s_Queue = queue;
+
+        glfwSetJoystickCallback(&Gamepad::OnJoystick);
+
+        // Pads that were plugged in before startup never produce a callback
+        for (i32 joystick = GLFW_JOYSTICK_1; joystick <= GLFW_JOYSTICK_LAST; ++joystick) {
+            if (glfwJoystickIsGamepad(joystick)) {
+                Connect(static_cast<u8>(joystick));
+            }
+        }
+    }
+
+    void Gamepad::Update()
+    {
+        s_PreviousButtons = s_Buttons;
+
+        // Pads gone since the last frame read as released from here on, so held buttons report one release edge
+        for (usize gamepad = 0; gamepad < MaxGamepads; ++gamepad) {
+            if ((s_ConnectedMask >> gamepad) & 1) continue;
+
+            s_Buttons[gamepad] = 0;
+            for (usize axis = 0; axis < AxisCount; ++axis) {
+                s_RawAxes[axis][gamepad] = 0.0f;
+            }
+        }
+
+        u32 pending = s_ConnectedMask;
+        while (pending) {
+            const u8 gamepad = static_cast<u8>(std::countr_zero(pending));
+            pending &= pending - 1;
+
+            GLFWgamepadstate state;
+            if (!glfwGetGamepadState(gamepad, &state)) continue;
+
+            u16 buttons = 0;
+            for (usize button = 0; button < ButtonCount; ++button) {
+                buttons |= static_cast<u16>((state.buttons[button] == GLFW_PRESS) << button);
+            }
+            s_Buttons[gamepad] = buttons;
+
+            for (usize axis = 0; axis < AxisCount; ++axis) {
+                s_RawAxes[axis][gamepad] = state.axes[axis];
+            }
+
+            // GLFW reports triggers in [-1, 1] with -1 at rest
+            for (auto axis : { GamepadAxis::LeftTrigger, GamepadAxis::RightTrigger }) {
+                f32& value = s_RawAxes[static_cast<usize>(axis)][gamepad];
+                value = (value + 1.0f) * 0.5f;
+            }
+        }
+
+        ApplyDeadZones();
+    }
+
+    void Gamepad::OnJoystick(i32 joystick, i32 event)
+    {
+        if (joystick < 0 || joystick >= static_cast<i32>(MaxGamepads)) return;
+
+        if (event == GLFW_CONNECTED) {
+            if (glfwJoystickIsGamepad(joystick)) {
+                Connect(static_cast<u8>(joystick));
+            } else {
+                LOG_DEBUG("Ignoring joystick {} (\"{}\"), it has no gamepad mapping", joystick, glfwGetJoystickName(joystick));
+            }
+        } else if (event == GLFW_DISCONNECTED) {
+            Disconnect(static_cast<u8>(joystick));
+        }
+    }
+
+    void Gamepad::Connect(u8 gamepad)
+    {
+        if (IsConnected(gamepad)) return;
+
+        s_ConnectedMask |= 1u << gamepad;
+
+        LOG_INFO("Gamepad {} connected: {}", gamepad, GetName(gamepad));
+
+        if (s_Queue) {
+            s_Queue->Push(GamepadConnectedEvent(gamepad));
+        }
+    }
+
+    void Gamepad::Disconnect(u8 gamepad)
+    {
+        if (!IsConnected(gamepad)) return;
+
+        // Buttons and axes are cleared by the next Update, after it saved them as the previous state
+        s_ConnectedMask &= ~(1u << gamepad);
+
+        LOG_INFO("Gamepad {} disconnected", gamepad);
+
+        if (s_Queue) {
+            s_Queue->Push(GamepadDisconnectedEvent(gamepad));
+        }
+    }
+
+    void Gamepad::ApplyDeadZones()
+    {
+        // Fixed-width loops over every slot, connected or not, so the cost doesn't depend on the pad count
+        const f32 stickDeadZone = s_StickDeadZone;
+        const f32 stickScale = 1.0f / (1.0f - stickDeadZone);
+
+        for (usize stick = 0; stick < 2; ++stick) {
+            const auto& rawX = s_RawAxes[stick * 2];
+            const auto& rawY = s_RawAxes[stick * 2 + 1];
+            auto& outX = s_Axes[stick * 2];
+            auto& outY = s_Axes[stick * 2 + 1];
+
+            for (usize i = 0; i < MaxGamepads; ++i) {
+                const f32 x = rawX[i];
+                const f32 y = rawY[i];
+
+                // Radial dead zone, rescaled so output starts at zero right past its edge
+                const f32 magnitude = std::sqrt(x * x + y * y);
+                const f32 scaled = std::min((magnitude - stickDeadZone) * stickScale, 1.0f);
+                const f32 factor = magnitude > stickDeadZone ? scaled / magnitude : 0.0f;
+
+                outX[i] = x * factor;
+                outY[i] = y * factor;
+            }
+        }
+
+        const f32 triggerDeadZone = s_TriggerDeadZone;
+        const f32 triggerScale = 1.0f / (1.0f - triggerDeadZone);
+
+        for (auto axis : { GamepadAxis::LeftTrigger, GamepadAxis::RightTrigger }) {
+            const auto& raw = s_RawAxes[static_cast<usize>(axis)];
+            auto& out = s_Axes[static_cast<usize>(axis)];
+
+            for (usize i = 0; i < MaxGamepads; ++i) {
+                out[i] = std::clamp((raw[i] - triggerDeadZone) * triggerScale, 0.0f, 1.0f);
+            }
+        }
+    }
+
+}
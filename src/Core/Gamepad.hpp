@@ -0,0 +1,88 @@
+#pragma once
+
+#include "KeyCodes.hpp"
+#include "Events/CoreEvents.hpp"
+
+namespace Core {
+
+    // Polled gamepad state. Every connected pad is read once per frame from
+    // Input::Update into flat arrays; only connect/disconnect go through the
+    // event queue.
+    class Gamepad
+    {
+        friend class Application;
+        friend class Input;
+    public:
+        static constexpr usize MaxGamepads = 16;
+        static constexpr usize ButtonCount = static_cast<usize>(GamepadButton::DpadLeft) + 1;
+        static constexpr usize AxisCount = static_cast<usize>(GamepadAxis::RightTrigger) + 1;
+
+    public:
+        [[nodiscard]] inline static bool IsConnected(u8 gamepad) noexcept
+        {
+            return gamepad < MaxGamepads && ((s_ConnectedMask >> gamepad) & 1);
+        }
+
+        [[nodiscard]] inline static u32 GetConnectedMask() noexcept
+        {
+            return s_ConnectedMask;
+        }
+
+        [[nodiscard]] inline static bool IsButtonDown(u8 gamepad, GamepadButton button) noexcept
+        {
+            return gamepad < MaxGamepads && TestButton(s_Buttons[gamepad], button);
+        }
+
+        [[nodiscard]] inline static bool IsButtonPressed(u8 gamepad, GamepadButton button) noexcept
+        {
+            return gamepad < MaxGamepads && TestButton(s_Buttons[gamepad] & ~s_PreviousButtons[gamepad], button);
+        }
+
+        [[nodiscard]] inline static bool IsButtonReleased(u8 gamepad, GamepadButton button) noexcept
+        {
+            return gamepad < MaxGamepads && TestButton(~s_Buttons[gamepad] & s_PreviousButtons[gamepad], button);
+        }
+
+        // Sticks in [-1, 1] with a radial dead zone, triggers in [0, 1]
+        [[nodiscard]] inline static f32 GetAxis(u8 gamepad, GamepadAxis axis) noexcept
+        {
+            return gamepad < MaxGamepads ? s_Axes[static_cast<usize>(axis)][gamepad] : 0.0f;
+        }
+
+        static std::string_view GetName(u8 gamepad);
+
+        static void SetDeadZones(f32 stick, f32 trigger);
+
+    protected:
+        static void Init(EventQueue<CoreEvents>* queue);
+        static void Update();
+
+    private:
+        [[nodiscard]] inline static bool TestButton(u32 buttons, GamepadButton button) noexcept
+        {
+            return (buttons >> static_cast<u32>(button)) & 1;
+        }
+
+        static void OnJoystick(i32 joystick, i32 event);
+        static void Connect(u8 gamepad);
+        static void Disconnect(u8 gamepad);
+        static void ApplyDeadZones();
+
+    private:
+        using AxisArray = std::array<std::array<f32, MaxGamepads>, AxisCount>;
+
+        inline static EventQueue<CoreEvents>* s_Queue = nullptr;
+        inline static u32 s_ConnectedMask = 0;
+
+        inline static std::array<u16, MaxGamepads> s_Buttons {};
+        inline static std::array<u16, MaxGamepads> s_PreviousButtons {};
+
+        // Axis-major, so dead zones are applied across all pads in one pass
+        alignas(64) inline static AxisArray s_RawAxes {};
+        alignas(64) inline static AxisArray s_Axes {};
+
+        inline static f32 s_StickDeadZone = 0.15f;
+        inline static f32 s_TriggerDeadZone = 0.05f;
+    };
+
+}
@@ -0,0 +1,318 @@
+#include "IO.hpp"
+
+#include "Core/Metrics/Metrics.hpp"
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Core {
+
+    namespace {
+
+        constexpr u32 MaxQueueDepth = 0xFFFF;
+        constexpr usize BufferAlignment = 4096;
+
+        inline u32 MakeRequestID(u32 slot, u16 generation) noexcept
+        {
+            return (static_cast<u32>(generation) << 16) | (slot + 1);
+        }
+
+        void CloseNative(Detail::NativeFile file) noexcept
+        {
+#if defined(_WIN32)
+            CloseHandle(reinterpret_cast<HANDLE>(file));
+#else
+            close(static_cast<i32>(file));
+#endif
+        }
+
+    }
+
+    void IO::Init(EventQueue<CoreEvents>* queue, const Config& config)
+    {
+        s_Queue = queue;
+        s_Config = config;
+        s_Config.queueDepth = std::clamp(config.queueDepth, 1u, MaxQueueDepth);
+        s_Config.bufferCount = std::clamp(config.bufferCount, 1u, 0xFFFFu);
+        s_Config.bufferSize = std::max<u32>(config.bufferSize + BufferAlignment - 1, BufferAlignment) & ~static_cast<u32>(BufferAlignment - 1);
+
+        const usize poolSize = static_cast<usize>(s_Config.bufferCount) * s_Config.bufferSize;
+        s_BufferMemory = static_cast<std::byte*>(::operator new(poolSize, std::align_val_t(BufferAlignment)));
+
+        s_BufferInUse.assign(s_Config.bufferCount, false);
+        s_FreeBuffers.clear();
+        for (u32 i = s_Config.bufferCount; i-- > 0;) {
+            s_FreeBuffers.push_back(static_cast<u16>(i));
+        }
+
+        s_Slots.assign(s_Config.queueDepth, Slot {});
+        s_FreeSlots.clear();
+        for (u32 i = s_Config.queueDepth; i-- > 0;) {
+            s_FreeSlots.push_back(i);
+        }
+        s_Queued.reserve(s_Config.queueDepth);
+
+        if (!s_Config.forceFallback) {
+            s_Backend = Detail::CreateUringBackend(s_Config.queueDepth, s_BufferMemory, s_Config.bufferCount, s_Config.bufferSize);
+        }
+        if (!s_Backend) {
+            s_Backend = Detail::CreateThreadBackend(std::max(s_Config.fallbackThreads, 1u));
+        }
+
+        LOG_INFO("IO: {} backend, {} buffers of {} KiB, queue depth {}",
+            s_Backend->GetName(), s_Config.bufferCount, s_Config.bufferSize / 1024, s_Config.queueDepth);
+    }
+
+    void IO::Shutdown()
+    {
+        if (!s_Backend) return;
+
+        // Backends finish or wait out everything in flight before they go away
+        s_Backend.reset();
+        s_Queued.clear();
+        s_Retired.clear();
+        s_Slots.clear();
+        s_FreeSlots.clear();
+        s_InFlight = 0;
+
+        for (Detail::NativeFile file : s_Files) {
+            if (file >= 0) CloseNative(file);
+        }
+        s_Files.clear();
+        s_FreeFiles.clear();
+
+        ::operator delete(s_BufferMemory, std::align_val_t(BufferAlignment));
+        s_BufferMemory = nullptr;
+        s_FreeBuffers.clear();
+        s_BufferInUse.clear();
+        s_Queue = nullptr;
+    }
+
+    void IO::Update()
+    {
+        static Metrics::Counter& submittedCounter = Metrics::Registry::GetCounter("io.submitted");
+        static Metrics::Counter& completedCounter = Metrics::Registry::GetCounter("io.completed");
+        static Metrics::Counter& failedCounter = Metrics::Registry::GetCounter("io.failed");
+        static Metrics::Gauge& inFlightGauge = Metrics::Registry::GetGauge("io.in_flight");
+
+        if (!s_Backend) return;
+
+        // Results reaped last update have had a full frame to be polled
+        for (u32 index : s_Retired) {
+            s_Slots[index].state = SlotState::Free;
+            s_FreeSlots.push_back(index);
+        }
+        s_Retired.clear();
+
+        if (!s_Queued.empty()) {
+            for (const Detail::IOCommand& command : s_Queued) {
+                s_Slots[(command.request & 0xFFFF) - 1].state = SlotState::InFlight;
+            }
+
+            s_Backend->Submit(s_Queued);
+
+            s_InFlight += static_cast<u32>(s_Queued.size());
+            submittedCounter.Increment(s_Queued.size());
+            s_Queued.clear();
+        }
+
+        static std::vector<Detail::IOCompletion> completions;
+        completions.clear();
+        s_Backend->Reap(completions);
+
+        for (const Detail::IOCompletion& completion : completions) {
+            const u32 index = (completion.request & 0xFFFF) - 1;
+            Slot& slot = s_Slots[index];
+
+            slot.state = SlotState::Complete;
+            slot.result.result = completion.result;
+            s_Retired.push_back(index);
+
+            if (completion.result < 0) failedCounter.Increment();
+
+            if (s_Queue) {
+                s_Queue->Push(IOCompletedEvent(completion.request, slot.result.op, slot.result.buffer, completion.result));
+            }
+        }
+
+        s_InFlight -= static_cast<u32>(completions.size());
+        completedCounter.Increment(completions.size());
+        inFlightGauge.Set(static_cast<f64>(s_InFlight));
+    }
+
+    std::expected<IOFile, std::string> IO::Open(const std::filesystem::path& path, OpenMode mode)
+    {
+#if defined(_WIN32)
+        DWORD access = GENERIC_READ;
+        DWORD disposition = OPEN_EXISTING;
+        if (mode == OpenMode::Write) {
+            access = GENERIC_WRITE;
+            disposition = CREATE_ALWAYS;
+        } else if (mode == OpenMode::ReadWrite) {
+            access = GENERIC_READ | GENERIC_WRITE;
+            disposition = OPEN_ALWAYS;
+        }
+
+        HANDLE handle = CreateFileW(path.c_str(), access, FILE_SHARE_READ, nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (handle == INVALID_HANDLE_VALUE) {
+            return std::unexpected(std::format("Failed to open {}: error {}", path.string(), GetLastError()));
+        }
+
+        const Detail::NativeFile native = reinterpret_cast<Detail::NativeFile>(handle);
+#else
+        i32 flags = O_RDONLY;
+        if (mode == OpenMode::Write) {
+            flags = O_WRONLY | O_CREAT | O_TRUNC;
+        } else if (mode == OpenMode::ReadWrite) {
+            flags = O_RDWR | O_CREAT;
+        }
+
+        const i32 fd = open(path.c_str(), flags | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            return std::unexpected(std::format("Failed to open {}: {}", path.string(), std::strerror(errno)));
+        }
+
+        const Detail::NativeFile native = fd;
+#endif
+
+        IOFile file;
+        if (!s_FreeFiles.empty()) {
+            file.index = s_FreeFiles.back();
+            s_FreeFiles.pop_back();
+            s_Files[file.index] = native;
+        } else {
+            file.index = static_cast<u32>(s_Files.size());
+            s_Files.push_back(native);
+        }
+
+        return file;
+    }
+
+    void IO::Close(IOFile file)
+    {
+        if (!file.IsValid() || file.index >= s_Files.size() || s_Files[file.index] < 0) return;
+
+        CloseNative(s_Files[file.index]);
+        s_Files[file.index] = -1;
+        s_FreeFiles.push_back(file.index);
+    }
+
+    std::optional<u64> IO::GetFileSize(IOFile file)
+    {
+        if (!file.IsValid() || file.index >= s_Files.size() || s_Files[file.index] < 0) return std::nullopt;
+
+#if defined(_WIN32)
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(reinterpret_cast<HANDLE>(s_Files[file.index]), &size)) return std::nullopt;
+        return static_cast<u64>(size.QuadPart);
+#else
+        struct stat info;
+        if (fstat(static_cast<i32>(s_Files[file.index]), &info) != 0) return std::nullopt;
+        return static_cast<u64>(info.st_size);
+#endif
+    }
+
+    std::optional<IOBuffer> IO::AcquireBuffer()
+    {
+        if (s_FreeBuffers.empty()) return std::nullopt;
+
+        const u16 index = s_FreeBuffers.back();
+        s_FreeBuffers.pop_back();
+        s_BufferInUse[index] = true;
+
+        return IOBuffer { index, GetBuffer(index) };
+    }
+
+    void IO::ReleaseBuffer(u16 buffer)
+    {
+        if (buffer >= s_BufferInUse.size() || !s_BufferInUse[buffer]) return;
+
+        s_BufferInUse[buffer] = false;
+        s_FreeBuffers.push_back(buffer);
+    }
+
+    std::span<std::byte> IO::GetBuffer(u16 buffer)
+    {
+        if (buffer >= s_Config.bufferCount || !s_BufferMemory) return {};
+        return std::span<std::byte>(s_BufferMemory + static_cast<usize>(buffer) * s_Config.bufferSize, s_Config.bufferSize);
+    }
+
+    std::expected<IORequest, std::string> IO::Read(IOFile file, u64 offset, u16 buffer, u32 size)
+    {
+        return Enqueue(IOOp::Read, file, offset, buffer, size);
+    }
+
+    std::expected<IORequest, std::string> IO::Write(IOFile file, u64 offset, u16 buffer, u32 size)
+    {
+        return Enqueue(IOOp::Write, file, offset, buffer, size);
+    }
+
+    std::expected<IORequest, std::string> IO::Enqueue(IOOp op, IOFile file, u64 offset, u16 buffer, u32 size)
+    {
+        if (!s_Backend) {
+            return std::unexpected("IO is not initialized");
+        }
+        if (!file.IsValid() || file.index >= s_Files.size() || s_Files[file.index] < 0) {
+            return std::unexpected("Invalid file");
+        }
+        if (buffer >= s_BufferInUse.size() || !s_BufferInUse[buffer]) {
+            return std::unexpected(std::format("Buffer {} is not acquired", buffer));
+        }
+        if (size > s_Config.bufferSize) {
+            return std::unexpected(std::format("Request of {} bytes exceeds the buffer size of {}", size, s_Config.bufferSize));
+        }
+        if (s_FreeSlots.empty()) {
+            return std::unexpected(std::format("All {} request slots are in use", s_Config.queueDepth));
+        }
+
+        const u32 index = s_FreeSlots.back();
+        s_FreeSlots.pop_back();
+
+        Slot& slot = s_Slots[index];
+        slot.generation = slot.generation == 0xFFFF ? 1 : slot.generation + 1;
+        slot.state = SlotState::Queued;
+        slot.result = IOResult { op, buffer, 0 };
+
+        const u32 id = MakeRequestID(index, slot.generation);
+
+        s_Queued.push_back(Detail::IOCommand {
+            .request = id,
+            .op = op,
+            .buffer = buffer,
+            .size = size,
+            .file = s_Files[file.index],
+            .offset = offset,
+            .data = GetBuffer(buffer).data()
+        });
+
+        return IORequest { id };
+    }
+
+    std::optional<IOResult> IO::Poll(IORequest request)
+    {
+        const Slot* slot = FindSlot(request);
+        if (!slot || slot->state != SlotState::Complete) return std::nullopt;
+
+        return slot->result;
+    }
+
+    IO::Slot* IO::FindSlot(IORequest request) noexcept
+    {
+        const u32 index = (request.id & 0xFFFF) - 1;
+        if (!request.IsValid() || index >= s_Slots.size()) return nullptr;
+
+        Slot& slot = s_Slots[index];
+        return slot.generation == (request.id >> 16) ? &slot : nullptr;
+    }
+
+    std::string_view IO::GetBackendName() noexcept
+    {
+        return s_Backend ? s_Backend->GetName() : "none";
+    }
+
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "IOBackend.hpp"
+
+namespace Core {
+
+    struct IOFile
+    {
+        static constexpr u32 Invalid = std::numeric_limits<u32>::max();
+
+        u32 index = Invalid;
+
+        [[nodiscard]] constexpr bool IsValid() const noexcept { return index != Invalid; }
+    };
+
+    struct IORequest
+    {
+        u32 id = 0;
+
+        [[nodiscard]] constexpr bool IsValid() const noexcept { return id != 0; }
+    };
+
+    // One of the registered buffers. Reads land in it and writes are sourced from it.
+    struct IOBuffer
+    {
+        u16 index = 0;
+        std::span<std::byte> data;
+    };
+
+    struct IOResult
+    {
+        IOOp op;
+        u16 buffer;
+        i32 result;
+    };
+
+    struct IOConfig
+    {
+        u32 queueDepth = 256;
+        u32 bufferCount = 64;
+        u32 bufferSize = 256 * 1024;
+        u32 fallbackThreads = 2;
+        bool forceFallback = false;
+    };
+
+    // Asynchronous positioned reads and writes. Requests are queued by the
+    // main thread and submitted together in IO::Update, which also reaps
+    // completions and sends one IOCompletedEvent for each. On Linux this goes
+    // through io_uring with the buffer pool registered up front; elsewhere, or
+    // when the kernel refuses io_uring, a few IO threads do blocking calls.
+    class IO
+    {
+        friend class Application;
+    public:
+        using Config = IOConfig;
+
+        enum class OpenMode : u8
+        {
+            Read,
+            Write,      // Creates or truncates
+            ReadWrite   // Creates if missing
+        };
+
+    public:
+        // Opening is synchronous. Close only once no request on the file is in flight.
+        static std::expected<IOFile, std::string> Open(const std::filesystem::path& path, OpenMode mode = OpenMode::Read);
+        static void Close(IOFile file);
+        static std::optional<u64> GetFileSize(IOFile file);
+
+        // Buffers are owned by the caller from Acquire until Release, across any number of requests
+        static std::optional<IOBuffer> AcquireBuffer();
+        static void ReleaseBuffer(u16 buffer);
+        [[nodiscard]] static std::span<std::byte> GetBuffer(u16 buffer);
+        [[nodiscard]] inline static u32 GetBufferSize() noexcept { return s_Config.bufferSize; }
+
+        // size must fit in the buffer. Nothing reaches the kernel before the next IO::Update.
+        static std::expected<IORequest, std::string> Read(IOFile file, u64 offset, u16 buffer, u32 size);
+        static std::expected<IORequest, std::string> Write(IOFile file, u64 offset, u16 buffer, u32 size);
+
+        // A completed request stays pollable until the IO::Update after the one that reaped it
+        static std::optional<IOResult> Poll(IORequest request);
+
+        [[nodiscard]] static std::string_view GetBackendName() noexcept;
+        [[nodiscard]] inline static u32 GetInFlightCount() noexcept { return s_InFlight; }
+
+    protected:
+        static void Init(EventQueue<CoreEvents>* queue, const Config& config = Config());
+        static void Update();
+        static void Shutdown();
+
+    private:
+        enum class SlotState : u8
+        {
+            Free,
+            Queued,
+            InFlight,
+            Complete
+        };
+
+        struct Slot
+        {
+            u16 generation = 0;
+            SlotState state = SlotState::Free;
+            IOResult result {};
+        };
+
+        static std::expected<IORequest, std::string> Enqueue(IOOp op, IOFile file, u64 offset, u16 buffer, u32 size);
+        static Slot* FindSlot(IORequest request) noexcept;
+
+    private:
+        inline static Config s_Config;
+        inline static EventQueue<CoreEvents>* s_Queue = nullptr;
+        inline static std::unique_ptr<Detail::IOBackend> s_Backend;
+
+        inline static std::byte* s_BufferMemory = nullptr;
+        inline static std::vector<u16> s_FreeBuffers;
+        inline static std::vector<bool> s_BufferInUse;
+
+        inline static std::vector<Slot> s_Slots;
+        inline static std::vector<u32> s_FreeSlots;
+        inline static std::vector<Detail::IOCommand> s_Queued;
+        inline static std::vector<u32> s_Retired;
+        inline static u32 s_InFlight = 0;
+
+        inline static std::vector<Detail::NativeFile> s_Files;
+        inline static std::vector<u32> s_FreeFiles;
+    };
+
+}
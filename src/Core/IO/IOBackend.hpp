@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Core/Events/CoreEvents.hpp"
+
+namespace Core::Detail {
+
+    // File descriptor on POSIX, HANDLE on Windows
+    using NativeFile = i64;
+
+    struct IOCommand
+    {
+        u32 request;
+        IOOp op;
+        u16 buffer;
+        u32 size;
+        NativeFile file;
+        u64 offset;
+        std::byte* data;
+    };
+
+    struct IOCompletion
+    {
+        u32 request;
+        i32 result;
+    };
+
+    class IOBackend
+    {
+    public:
+        virtual ~IOBackend() = default;
+
+        [[nodiscard]] virtual std::string_view GetName() const noexcept = 0;
+
+        // Called once per IO::Update with everything queued since the last one
+        virtual void Submit(std::span<const IOCommand> commands) = 0;
+
+        // Appends finished requests without blocking
+        virtual void Reap(std::vector<IOCompletion>& completions) = 0;
+    };
+
+    // Null when io_uring is unavailable, the reason is logged
+    std::unique_ptr<IOBackend> CreateUringBackend(u32 queueDepth, std::byte* buffers, u32 bufferCount, u32 bufferSize);
+    std::unique_ptr<IOBackend> CreateThreadBackend(u32 threadCount);
+
+    // Blocking positioned transfer used by the thread backend, returns bytes or -errno
+    i32 TransferAt(IOOp op, NativeFile file, u64 offset, std::byte* data, u32 size) noexcept;
+
+}
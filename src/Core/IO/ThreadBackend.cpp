@@ -0,0 +1,142 @@
+#include "IOBackend.hpp"
+
+#include "Core/Threading.hpp"
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace Core::Detail {
+
+    i32 TransferAt(IOOp op, NativeFile file, u64 offset, std::byte* data, u32 size) noexcept
+    {
+        u32 done = 0;
+
+        // Short transfers are continued, a read that hits end of file stops early
+        while (done < size) {
+#if defined(_WIN32)
+            OVERLAPPED overlapped {};
+            overlapped.Offset = static_cast<DWORD>(offset + done);
+            overlapped.OffsetHigh = static_cast<DWORD>((offset + done) >> 32);
+
+            DWORD transferred = 0;
+            const BOOL ok = op == IOOp::Read
+                ? ReadFile(reinterpret_cast<HANDLE>(file), data + done, size - done, &transferred, &overlapped)
+                : WriteFile(reinterpret_cast<HANDLE>(file), data + done, size - done, &transferred, &overlapped);
+
+            if (!ok) {
+                if (GetLastError() == ERROR_HANDLE_EOF) break;
+                return -static_cast<i32>(GetLastError());
+            }
+#else
+            const ssize_t transferred = op == IOOp::Read
+                ? pread(static_cast<i32>(file), data + done, size - done, static_cast<off_t>(offset + done))
+                : pwrite(static_cast<i32>(file), data + done, size - done, static_cast<off_t>(offset + done));
+
+            if (transferred < 0) {
+                if (errno == EINTR) continue;
+                return -errno;
+            }
+#endif
+            if (transferred == 0) break;
+            done += static_cast<u32>(transferred);
+        }
+
+        return static_cast<i32>(done);
+    }
+
+    namespace {
+
+        // Blocking calls on a few dedicated threads. Commands are taken in
+        // submission order; completions are handed back under a second lock.
+        class ThreadBackend final : public IOBackend
+        {
+        public:
+            ThreadBackend(u32 threadCount)
+            {
+                m_Threads.reserve(threadCount);
+
+                for (u32 i = 0; i < threadCount; ++i) {
+                    m_Threads.emplace_back(&ThreadBackend::WorkerLoop, this, "IO " + std::to_string(i));
+                }
+            }
+
+            ~ThreadBackend() override
+            {
+                {
+                    std::scoped_lock lock(m_Mutex);
+                    m_Stopping = true;
+                }
+                m_WorkReady.notify_all();
+
+                m_Threads.clear();
+            }
+
+            std::string_view GetName() const noexcept override
+            {
+                return "thread pool";
+            }
+
+            void Submit(std::span<const IOCommand> commands) override
+            {
+                {
+                    std::scoped_lock lock(m_Mutex);
+                    m_Commands.insert(m_Commands.end(), commands.begin(), commands.end());
+                }
+                m_WorkReady.notify_all();
+            }
+
+            void Reap(std::vector<IOCompletion>& completions) override
+            {
+                std::scoped_lock lock(m_CompletionMutex);
+                completions.insert(completions.end(), m_Completions.begin(), m_Completions.end());
+                m_Completions.clear();
+            }
+
+        private:
+            void WorkerLoop(std::string name)
+            {
+                Threading::Topology::Apply(Threading::ThreadRole::IO, name);
+
+                for (;;) {
+                    IOCommand command;
+                    {
+                        std::unique_lock lock(m_Mutex);
+                        m_WorkReady.wait(lock, [this] { return m_Stopping || !m_Commands.empty(); });
+
+                        // Queued commands still run on shutdown, callers may be waiting on writes
+                        if (m_Commands.empty()) return;
+
+                        command = m_Commands.front();
+                        m_Commands.pop_front();
+                    }
+
+                    const i32 result = TransferAt(command.op, command.file, command.offset, command.data, command.size);
+
+                    std::scoped_lock lock(m_CompletionMutex);
+                    m_Completions.push_back(IOCompletion { command.request, result });
+                }
+            }
+
+        private:
+            std::vector<std::jthread> m_Threads;
+
+            std::mutex m_Mutex;
+            std::condition_variable m_WorkReady;
+            std::deque<IOCommand> m_Commands;
+            bool m_Stopping = false;
+
+            std::mutex m_CompletionMutex;
+            std::vector<IOCompletion> m_Completions;
+        };
+
+    }
+
+    std::unique_ptr<IOBackend> CreateThreadBackend(u32 threadCount)
+    {
+        return std::make_unique<ThreadBackend>(threadCount);
+    }
+
+}
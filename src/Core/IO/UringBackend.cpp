@@ -0,0 +1,258 @@
+#include "IOBackend.hpp"
+
+#if defined(__linux__)
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+namespace Core::Detail {
+
+#if defined(__linux__)
+    namespace {
+
+        inline i32 Setup(u32 entries, io_uring_params& params) noexcept
+        {
+            return static_cast<i32>(syscall(__NR_io_uring_setup, entries, &params));
+        }
+
+        inline i32 Enter(i32 ring, u32 toSubmit, u32 minComplete, u32 flags) noexcept
+        {
+            return static_cast<i32>(syscall(__NR_io_uring_enter, ring, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        inline i32 Register(i32 ring, u32 opcode, const void* args, u32 count) noexcept
+        {
+            return static_cast<i32>(syscall(__NR_io_uring_register, ring, opcode, args, count));
+        }
+
+        // The rings are shared with the kernel: we own the SQ tail and the CQ
+        // head, the kernel owns the other two.
+        inline u32 LoadAcquire(u32* value) noexcept
+        {
+            return std::atomic_ref<u32>(*value).load(std::memory_order_acquire);
+        }
+
+        inline void StoreRelease(u32* value, u32 data) noexcept
+        {
+            std::atomic_ref<u32>(*value).store(data, std::memory_order_release);
+        }
+
+        // Raw syscalls and mmap'd rings, no liburing. Submission is batched: every
+        // command of an update is written to the SQ ring before a single
+        // io_uring_enter. Completions are reaped straight from the CQ ring,
+        // only entering the kernel again if it could not take the whole batch.
+        class UringBackend final : public IOBackend
+        {
+        public:
+            ~UringBackend() override
+            {
+                // Buffers must outlive every request the kernel still holds
+                while (m_InFlight > 0) {
+                    if (m_Unsubmitted > 0) Flush();
+
+                    if (Enter(m_Ring, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) break;
+
+                    std::vector<IOCompletion> discarded;
+                    Reap(discarded);
+                }
+
+                if (m_Sqes) munmap(m_Sqes, m_SqesSize);
+                if (m_CqPtr && m_CqPtr != m_SqPtr) munmap(m_CqPtr, m_CqSize);
+                if (m_SqPtr) munmap(m_SqPtr, m_SqSize);
+                if (m_Ring >= 0) close(m_Ring);
+            }
+
+            static std::unique_ptr<UringBackend> Create(u32 queueDepth, std::byte* buffers, u32 bufferCount, u32 bufferSize)
+            {
+                auto backend = std::unique_ptr<UringBackend>(new UringBackend());
+
+                io_uring_params params {};
+                backend->m_Ring = Setup(queueDepth, params);
+                if (backend->m_Ring < 0) {
+                    LOG_WARN("io_uring unavailable ({}), using IO threads", std::strerror(errno));
+                    return nullptr;
+                }
+
+                if (!backend->MapRings(params)) {
+                    LOG_WARN("Failed to map io_uring rings ({}), using IO threads", std::strerror(errno));
+                    return nullptr;
+                }
+
+                std::vector<iovec> iovecs(bufferCount);
+                for (u32 i = 0; i < bufferCount; ++i) {
+                    iovecs[i].iov_base = buffers + static_cast<usize>(i) * bufferSize;
+                    iovecs[i].iov_len = bufferSize;
+                }
+
+                // Registration pins the pages, which RLIMIT_MEMLOCK may refuse. Unregistered buffers still work.
+                backend->m_FixedBuffers = Register(backend->m_Ring, IORING_REGISTER_BUFFERS, iovecs.data(), bufferCount) == 0;
+                if (!backend->m_FixedBuffers) {
+                    LOG_WARN("io_uring buffer registration failed ({}), falling back to unregistered reads", std::strerror(errno));
+                }
+
+                return backend;
+            }
+
+            std::string_view GetName() const noexcept override
+            {
+                return m_FixedBuffers ? "io_uring" : "io_uring (unregistered buffers)";
+            }
+
+            void Submit(std::span<const IOCommand> commands) override
+            {
+                u32 tail = *m_SqTail;
+
+                for (const IOCommand& command : commands) {
+                    // IO keeps at most queueDepth requests outstanding, which is also the ring size
+                    assert(tail - LoadAcquire(m_SqHead) < m_SqEntries);
+
+                    const u32 index = tail & m_SqMask;
+                    io_uring_sqe& sqe = m_Sqes[index];
+                    std::memset(&sqe, 0, sizeof(sqe));
+
+                    if (m_FixedBuffers) {
+                        sqe.opcode = command.op == IOOp::Read ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+                        sqe.buf_index = command.buffer;
+                    } else {
+                        sqe.opcode = command.op == IOOp::Read ? IORING_OP_READ : IORING_OP_WRITE;
+                    }
+
+                    sqe.fd = static_cast<i32>(command.file);
+                    sqe.off = command.offset;
+                    sqe.addr = reinterpret_cast<u64>(command.data);
+                    sqe.len = command.size;
+                    sqe.user_data = command.request;
+
+                    m_SqArray[index] = index;
+                    ++tail;
+                }
+
+                StoreRelease(m_SqTail, tail);
+
+                m_Unsubmitted += static_cast<u32>(commands.size());
+                m_InFlight += static_cast<u32>(commands.size());
+
+                Flush();
+            }
+
+            void Reap(std::vector<IOCompletion>& completions) override
+            {
+                if (m_Unsubmitted > 0) Flush();
+
+                u32 head = *m_CqHead;
+                const u32 tail = LoadAcquire(m_CqTail);
+
+                for (; head != tail; ++head) {
+                    const io_uring_cqe& cqe = m_Cqes[head & m_CqMask];
+                    completions.push_back(IOCompletion { static_cast<u32>(cqe.user_data), cqe.res });
+                    --m_InFlight;
+                }
+
+                StoreRelease(m_CqHead, head);
+            }
+
+        private:
+            UringBackend() = default;
+
+            bool MapRings(const io_uring_params& params)
+            {
+                m_SqSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+                m_CqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+                const bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+                if (singleMap) {
+                    m_SqSize = m_CqSize = std::max(m_SqSize, m_CqSize);
+                }
+
+                m_SqPtr = mmap(nullptr, m_SqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_Ring, IORING_OFF_SQ_RING);
+                if (m_SqPtr == MAP_FAILED) {
+                    m_SqPtr = nullptr;
+                    return false;
+                }
+
+                if (singleMap) {
+                    m_CqPtr = m_SqPtr;
+                } else {
+                    m_CqPtr = mmap(nullptr, m_CqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_Ring, IORING_OFF_CQ_RING);
+                    if (m_CqPtr == MAP_FAILED) {
+                        m_CqPtr = nullptr;
+                        return false;
+                    }
+                }
+
+                m_SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+                void* sqes = mmap(nullptr, m_SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_Ring, IORING_OFF_SQES);
+                if (sqes == MAP_FAILED) return false;
+                m_Sqes = static_cast<io_uring_sqe*>(sqes);
+
+                auto* sq = static_cast<std::byte*>(m_SqPtr);
+                m_SqHead = reinterpret_cast<u32*>(sq + params.sq_off.head);
+                m_SqTail = reinterpret_cast<u32*>(sq + params.sq_off.tail);
+                m_SqArray = reinterpret_cast<u32*>(sq + params.sq_off.array);
+                m_SqMask = *reinterpret_cast<u32*>(sq + params.sq_off.ring_mask);
+                m_SqEntries = params.sq_entries;
+
+                auto* cq = static_cast<std::byte*>(m_CqPtr);
+                m_CqHead = reinterpret_cast<u32*>(cq + params.cq_off.head);
+                m_CqTail = reinterpret_cast<u32*>(cq + params.cq_off.tail);
+                m_CqMask = *reinterpret_cast<u32*>(cq + params.cq_off.ring_mask);
+                m_Cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+                return true;
+            }
+
+            // Hands the written SQEs to the kernel. Whatever it does not take now stays in the ring for the next call.
+            void Flush() noexcept
+            {
+                const i32 submitted = Enter(m_Ring, m_Unsubmitted, 0, 0);
+
+                if (submitted >= 0) {
+                    m_Unsubmitted -= static_cast<u32>(submitted);
+                } else if (errno != EAGAIN && errno != EBUSY && errno != EINTR) {
+                    LOG_ERROR("io_uring_enter failed: {}", std::strerror(errno));
+                }
+            }
+
+        private:
+            i32 m_Ring = -1;
+            bool m_FixedBuffers = false;
+
+            void* m_SqPtr = nullptr;
+            void* m_CqPtr = nullptr;
+            usize m_SqSize = 0;
+            usize m_CqSize = 0;
+            usize m_SqesSize = 0;
+
+            u32* m_SqHead = nullptr;
+            u32* m_SqTail = nullptr;
+            u32* m_SqArray = nullptr;
+            u32 m_SqMask = 0;
+            u32 m_SqEntries = 0;
+            io_uring_sqe* m_Sqes = nullptr;
+
+            u32* m_CqHead = nullptr;
+            u32* m_CqTail = nullptr;
+            u32 m_CqMask = 0;
+            io_uring_cqe* m_Cqes = nullptr;
+
+            u32 m_Unsubmitted = 0;
+            u32 m_InFlight = 0;
+        };
+
+    }
+
+    std::unique_ptr<IOBackend> CreateUringBackend(u32 queueDepth, std::byte* buffers, u32 bufferCount, u32 bufferSize)
+    {
+        return UringBackend::Create(queueDepth, buffers, bufferCount, bufferSize);
+    }
+#else
+    std::unique_ptr<IOBackend> CreateUringBackend(u32, std::byte*, u32, u32)
+    {
+        return nullptr;
+    }
+#endif
+
+}
@@ -1,47 +1,50 @@
 #include "Input.hpp"
 
 #include "Application.hpp"
+#include "Gamepad.hpp"
 
 namespace Core {
 
     bool Input::IsKeyPressed(KeyCode key)
     {
-        return s_KeyData.find(key) != s_KeyData.end() && s_KeyData[key].state == KeyState::Pressed;
+        return GetKeyState(key) == KeyState::Pressed;
     }
 
     bool Input::IsKeyHeld(KeyCode key)
     {
-        return s_KeyData.find(key) != s_KeyData.end() && s_KeyData[key].state == KeyState::Held;
+        return GetKeyState(key) == KeyState::Held;
     }
 
     bool Input::IsKeyDown(KeyCode key)
     {
-        return s_KeyData.find(key) != s_KeyData.end() && (s_KeyData[key].state == KeyState::Pressed || s_KeyData[key].state == KeyState::Held);
+        const KeyState state = GetKeyState(key);
+        return state == KeyState::Pressed || state == KeyState::Held;
     }
 
     bool Input::IsKeyReleased(KeyCode key)
     {
-        return s_KeyData.find(key) != s_KeyData.end() && s_KeyData[key].state == KeyState::Released;
+        return GetKeyState(key) == KeyState::Released;
     }
 
     bool Input::IsMouseButtonPressed(MouseButton button)
     {
-        return s_MouseButtonData.find(button) != s_MouseButtonData.end() && s_MouseButtonData[button].state == KeyState::Pressed;
+        return GetButtonState(button) == KeyState::Pressed;
     }
 
     bool Input::IsMouseButtonHeld(MouseButton button)
     {
-        return s_MouseButtonData.find(button) != s_MouseButtonData.end() && s_MouseButtonData[button].state == KeyState::Held;
+        return GetButtonState(button) == KeyState::Held;
     }
 
     bool Input::IsMouseButtonDown(MouseButton button)
     {
-        return s_MouseButtonData.find(button) != s_MouseButtonData.end() && (s_MouseButtonData[button].state == KeyState::Pressed || s_MouseButtonData[button].state == KeyState::Held);
+        const KeyState state = GetButtonState(button);
+        return state == KeyState::Pressed || state == KeyState::Held;
     }
 
     bool Input::IsMouseButtonReleased(MouseButton button)
     {
-        return s_MouseButtonData.find(button) != s_MouseButtonData.end() && s_MouseButtonData[button].state == KeyState::Released;
+        return GetButtonState(button) == KeyState::Released;
     }
 
     f32 Input::GetMouseX()
@@ -61,14 +64,42 @@ namespace Core {
         return s_MousePos;
     }
 
+    InputSnapshot Input::GetSnapshot()
+    {
+        return s_Snapshots.Read();
+    }
+
+    void Input::TrackMouse()
+    {
+        if (s_MouseTrackers++ == 0) {
+            EventInterest::Add(EventMaskOf<MouseMovedEvent, MouseScrolledEvent>);
+        }
+    }
+
+    void Input::UntrackMouse()
+    {
+        if (s_MouseTrackers == 0) return;
+
+        if (--s_MouseTrackers == 0) {
+            EventInterest::Remove(EventMaskOf<MouseMovedEvent, MouseScrolledEvent>);
+        }
+    }
+
     void Input::Init()
     {
-        Application::RegisterOnEvent(Input::OnEvent);
+        // Mouse motion and scroll are still dispatched here, but only TrackMouse asks for them
+        Application::RegisterOnEvent(Input::OnEvent, EventMaskOf<
+            KeyPressedEvent, KeyReleasedEvent,
+            MouseButtonPressedEvent, MouseButtonReleasedEvent
+        >);
     }
 
     void Input::Update()
     {
-        for (auto& [key, data] : s_KeyData) {
+        // Everything up to here belongs to the previous frame, hand it to other threads
+        Publish();
+
+        for (auto& data : s_KeyData) {
             data.oldState = data.state;
             if (data.state == KeyState::Pressed) {
                 data.state = KeyState::Held;
@@ -77,7 +108,7 @@ namespace Core {
             }
         }
 
-        for (auto& [button, data] : s_MouseButtonData) {
+        for (auto& data : s_MouseButtonData) {
             data.oldState = data.state;
             if (data.state == KeyState::Pressed) {
                 data.state = KeyState::Held;
@@ -85,6 +116,8 @@ namespace Core {
                 data.state = KeyState::None;
             }
         }
+
+        Gamepad::Update();
     }
 
     void Input::OnEvent(EventDispatcher<CoreEvents>& dispatcher)
@@ -113,18 +146,29 @@ namespace Core {
             Input::UpdateMousePosition(e.x, e.y);
             return false;
         });
+
+        dispatcher.Dispatch<MouseScrolledEvent>([](const MouseScrolledEvent& e) {
+            Input::UpdateScroll(e.x, e.y);
+            return false;
+        });
     }
 
     void Input::UpdateKeyState(KeyCode key, KeyState state)
     {
-        auto& data = s_KeyData[key];
+        const usize index = static_cast<usize>(key);
+        if (index >= s_KeyData.size()) return;
+
+        auto& data = s_KeyData[index];
         data.oldState = data.state;
         data.state = state;
     }
 
     void Input::UpdateButtonState(MouseButton button, KeyState state)
     {
-        auto& data = s_MouseButtonData[button];
+        const usize index = static_cast<usize>(button);
+        if (index >= s_MouseButtonData.size()) return;
+
+        auto& data = s_MouseButtonData[index];
         data.oldState = data.state;
         data.state = state;
     }
@@ -134,4 +178,48 @@ namespace Core {
         s_MousePos = std::make_pair(x, y);
     }
 
+    void Input::UpdateScroll(f32 x, f32 y)
+    {
+        s_Scroll.first += x;
+        s_Scroll.second += y;
+    }
+
+    void Input::Publish()
+    {
+        InputSnapshot snapshot;
+        snapshot.frame = s_Frame++;
+
+        for (usize i = 0; i < s_KeyData.size(); ++i) {
+            snapshot.keys[i] = s_KeyData[i].state;
+        }
+
+        for (usize i = 0; i < s_MouseButtonData.size(); ++i) {
+            snapshot.buttons[i] = s_MouseButtonData[i].state;
+        }
+
+        snapshot.mouseX = s_MousePos.first;
+        snapshot.mouseY = s_MousePos.second;
+        snapshot.mouseDeltaX = s_MousePos.first - s_PublishedMousePos.first;
+        snapshot.mouseDeltaY = s_MousePos.second - s_PublishedMousePos.second;
+        snapshot.scrollX = s_Scroll.first;
+        snapshot.scrollY = s_Scroll.second;
+
+        s_Snapshots.Publish(snapshot);
+
+        s_PublishedMousePos = s_MousePos;
+        s_Scroll = std::make_pair(0.0f, 0.0f);
+    }
+
+    KeyState Input::GetKeyState(KeyCode key)
+    {
+        const usize index = static_cast<usize>(key);
+        return index < s_KeyData.size() ? s_KeyData[index].state : KeyState::None;
+    }
+
+    KeyState Input::GetButtonState(MouseButton button)
+    {
+        const usize index = static_cast<usize>(button);
+        return index < s_MouseButtonData.size() ? s_MouseButtonData[index].state : KeyState::None;
+    }
+
 }
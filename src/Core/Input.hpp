@@ -1,6 +1,7 @@
 #pragma once
 
 #include "KeyCodes.hpp"
+#include "SnapshotBuffer.hpp"
 #include "Events/CoreEvents.hpp"
 
 namespace Core {
@@ -17,6 +18,64 @@ namespace Core {
         KeyState oldState = KeyState::None;
     };
 
+    // Immutable copy of one completed frame of input, safe to read on any thread
+    struct InputSnapshot
+    {
+        static constexpr usize KeyCount = static_cast<usize>(KeyCode::Menu) + 1;
+        static constexpr usize ButtonCount = 8;
+
+        u64 frame = 0;
+
+        std::array<KeyState, KeyCount> keys;
+        std::array<KeyState, ButtonCount> buttons;
+
+        // Only updated while the mouse is tracked, see Input::TrackMouse
+        f32 mouseX = 0.0f;
+        f32 mouseY = 0.0f;
+        f32 mouseDeltaX = 0.0f;
+        f32 mouseDeltaY = 0.0f;
+        f32 scrollX = 0.0f;
+        f32 scrollY = 0.0f;
+
+        constexpr InputSnapshot() noexcept
+        {
+            keys.fill(KeyState::None);
+            buttons.fill(KeyState::None);
+        }
+
+        [[nodiscard]] constexpr KeyState GetKey(KeyCode key) const noexcept
+        {
+            const usize index = static_cast<usize>(key);
+            return index < KeyCount ? keys[index] : KeyState::None;
+        }
+
+        [[nodiscard]] constexpr KeyState GetButton(MouseButton button) const noexcept
+        {
+            const usize index = static_cast<usize>(button);
+            return index < ButtonCount ? buttons[index] : KeyState::None;
+        }
+
+        [[nodiscard]] constexpr bool IsKeyPressed(KeyCode key) const noexcept { return GetKey(key) == KeyState::Pressed; }
+        [[nodiscard]] constexpr bool IsKeyHeld(KeyCode key) const noexcept { return GetKey(key) == KeyState::Held; }
+        [[nodiscard]] constexpr bool IsKeyReleased(KeyCode key) const noexcept { return GetKey(key) == KeyState::Released; }
+
+        [[nodiscard]] constexpr bool IsKeyDown(KeyCode key) const noexcept
+        {
+            const KeyState state = GetKey(key);
+            return state == KeyState::Pressed || state == KeyState::Held;
+        }
+
+        [[nodiscard]] constexpr bool IsMouseButtonPressed(MouseButton button) const noexcept { return GetButton(button) == KeyState::Pressed; }
+        [[nodiscard]] constexpr bool IsMouseButtonHeld(MouseButton button) const noexcept { return GetButton(button) == KeyState::Held; }
+        [[nodiscard]] constexpr bool IsMouseButtonReleased(MouseButton button) const noexcept { return GetButton(button) == KeyState::Released; }
+
+        [[nodiscard]] constexpr bool IsMouseButtonDown(MouseButton button) const noexcept
+        {
+            const KeyState state = GetButton(button);
+            return state == KeyState::Pressed || state == KeyState::Held;
+        }
+    };
+
     class Input
     {
         friend class Application;
@@ -35,6 +94,14 @@ namespace Core {
         static f32 GetMouseY();
         static std::pair<f32, f32> GetMousePosition();
 
+        // Mouse position and scroll need window callbacks, which are only installed
+        // while someone tracks the mouse. Calls nest, pair each with an UntrackMouse.
+        static void TrackMouse();
+        static void UntrackMouse();
+
+        // Lock-free, callable from any thread. Returns the most recently completed frame.
+        static InputSnapshot GetSnapshot();
+
     protected:
         static void Init();
         static void Update();
@@ -44,11 +111,23 @@ namespace Core {
         static void UpdateKeyState(KeyCode key, KeyState state);
         static void UpdateButtonState(MouseButton button, KeyState state);
         static void UpdateMousePosition(f32 x, f32 y);
+        static void UpdateScroll(f32 x, f32 y);
+
+        static void Publish();
+
+        static KeyState GetKeyState(KeyCode key);
+        static KeyState GetButtonState(MouseButton button);
 
     private:
-        inline static std::map<KeyCode, KeyData> s_KeyData;
-        inline static std::map<MouseButton, ButtonData> s_MouseButtonData;
+        inline static std::array<KeyData, InputSnapshot::KeyCount> s_KeyData;
+        inline static std::array<ButtonData, InputSnapshot::ButtonCount> s_MouseButtonData;
         inline static std::pair<f32, f32> s_MousePos = std::make_pair(0.0f, 0.0f);
+        inline static std::pair<f32, f32> s_PublishedMousePos = std::make_pair(0.0f, 0.0f);
+        inline static std::pair<f32, f32> s_Scroll = std::make_pair(0.0f, 0.0f);
+
+        inline static u32 s_MouseTrackers = 0;
+        inline static u64 s_Frame = 0;
+        inline static SnapshotBuffer<InputSnapshot> s_Snapshots;
     };
 
 }
@@ -0,0 +1,407 @@
+#include "InputActions.hpp"
+
+#include "Input.hpp"
+
+namespace Core {
+
+    namespace {
+
+        struct KeyName
+        {
+            std::string_view name;
+            KeyCode key;
+        };
+
+        constexpr KeyName KeyNames[] = {
+            { "Space", KeyCode::Space },
+            { "Apostrophe", KeyCode::Apostrophe },
+            { "Comma", KeyCode::Comma },
+            { "Minus", KeyCode::Minus },
+            { "Period", KeyCode::Period },
+            { "Slash", KeyCode::Slash },
+            { "D0", KeyCode::D0 },
+            { "D1", KeyCode::D1 },
+            { "D2", KeyCode::D2 },
+            { "D3", KeyCode::D3 },
+            { "D4", KeyCode::D4 },
+            { "D5", KeyCode::D5 },
+            { "D6", KeyCode::D6 },
+            { "D7", KeyCode::D7 },
+            { "D8", KeyCode::D8 },
+            { "D9", KeyCode::D9 },
+            { "Semicolon", KeyCode::Semicolon },
+            { "Equal", KeyCode::Equal },
+            { "A", KeyCode::A },
+            { "B", KeyCode::B },
+            { "C", KeyCode::C },
+            { "D", KeyCode::D },
+            { "E", KeyCode::E },
+            { "F", KeyCode::F },
+            { "G", KeyCode::G },
+            { "H", KeyCode::H },
+            { "I", KeyCode::I },
+            { "J", KeyCode::J },
+            { "K", KeyCode::K },
+            { "L", KeyCode::L },
+            { "M", KeyCode::M },
+            { "N", KeyCode::N },
+            { "O", KeyCode::O },
+            { "P", KeyCode::P },
+            { "Q", KeyCode::Q },
+            { "R", KeyCode::R },
+            { "S", KeyCode::S },
+            { "T", KeyCode::T },
+            { "U", KeyCode::U },
+            { "V", KeyCode::V },
+            { "W", KeyCode::W },
+            { "X", KeyCode::X },
+            { "Y", KeyCode::Y },
+            { "Z", KeyCode::Z },
+            { "LeftBracket", KeyCode::LeftBracket },
+            { "Backslash", KeyCode::Backslash },
+            { "RightBracket", KeyCode::RightBracket },
+            { "GraveAccent", KeyCode::GraveAccent },
+            { "World1", KeyCode::World1 },
+            { "World2", KeyCode::World2 },
+            { "Escape", KeyCode::Escape },
+            { "Enter", KeyCode::Enter },
+            { "Tab", KeyCode::Tab },
+            { "Backspace", KeyCode::Backspace },
+            { "Insert", KeyCode::Insert },
+            { "Delete", KeyCode::Delete },
+            { "Right", KeyCode::Right },
+            { "Left", KeyCode::Left },
+            { "Down", KeyCode::Down },
+            { "Up", KeyCode::Up },
+            { "PageUp", KeyCode::PageUp },
+            { "PageDown", KeyCode::PageDown },
+            { "Home", KeyCode::Home },
+            { "End", KeyCode::End },
+            { "CapsLock", KeyCode::CapsLock },
+            { "ScrollLock", KeyCode::ScrollLock },
+            { "NumLock", KeyCode::NumLock },
+            { "PrintScreen", KeyCode::PrintScreen },
+            { "Pause", KeyCode::Pause },
+            { "F1", KeyCode::F1 },
+            { "F2", KeyCode::F2 },
+            { "F3", KeyCode::F3 },
+            { "F4", KeyCode::F4 },
+            { "F5", KeyCode::F5 },
+            { "F6", KeyCode::F6 },
+            { "F7", KeyCode::F7 },
+            { "F8", KeyCode::F8 },
+            { "F9", KeyCode::F9 },
+            { "F10", KeyCode::F10 },
+            { "F11", KeyCode::F11 },
+            { "F12", KeyCode::F12 },
+            { "F13", KeyCode::F13 },
+            { "F14", KeyCode::F14 },
+            { "F15", KeyCode::F15 },
+            { "F16", KeyCode::F16 },
+            { "F17", KeyCode::F17 },
+            { "F18", KeyCode::F18 },
+            { "F19", KeyCode::F19 },
+            { "F20", KeyCode::F20 },
+            { "F21", KeyCode::F21 },
+            { "F22", KeyCode::F22 },
+            { "F23", KeyCode::F23 },
+            { "F24", KeyCode::F24 },
+            { "F25", KeyCode::F25 },
+            { "KP0", KeyCode::KP0 },
+            { "KP1", KeyCode::KP1 },
+            { "KP2", KeyCode::KP2 },
+            { "KP3", KeyCode::KP3 },
+            { "KP4", KeyCode::KP4 },
+            { "KP5", KeyCode::KP5 },
+            { "KP6", KeyCode::KP6 },
+            { "KP7", KeyCode::KP7 },
+            { "KP8", KeyCode::KP8 },
+            { "KP9", KeyCode::KP9 },
+            { "KPDecimal", KeyCode::KPDecimal },
+            { "KPDivide", KeyCode::KPDivide },
+            { "KPMultiply", KeyCode::KPMultiply },
+            { "KPSubtract", KeyCode::KPSubtract },
+            { "KPAdd", KeyCode::KPAdd },
+            { "KPEnter", KeyCode::KPEnter },
+            { "KPEqual", KeyCode::KPEqual },
+            { "LeftShift", KeyCode::LeftShift },
+            { "LeftControl", KeyCode::LeftControl },
+            { "LeftAlt", KeyCode::LeftAlt },
+            { "LeftSuper", KeyCode::LeftSuper },
+            { "RightShift", KeyCode::RightShift },
+            { "RightControl", KeyCode::RightControl },
+            { "RightAlt", KeyCode::RightAlt },
+            { "RightSuper", KeyCode::RightSuper },
+            { "Menu", KeyCode::Menu },
+        };
+
+        struct ButtonName
+        {
+            std::string_view name;
+            MouseButton button;
+        };
+
+        constexpr ButtonName ButtonNames[] = {
+            { "Mouse0", MouseButton::Button0 },
+            { "Mouse1", MouseButton::Button1 },
+            { "Mouse2", MouseButton::Button2 },
+            { "Mouse3", MouseButton::Button3 },
+            { "Mouse4", MouseButton::Button4 },
+            { "Mouse5", MouseButton::Button5 },
+            { "MouseLeft", MouseButton::Left },
+            { "MouseRight", MouseButton::Right },
+            { "MouseMiddle", MouseButton::Middle }
+        };
+
+        std::string_view Trim(std::string_view text)
+        {
+            const usize begin = text.find_first_not_of(" \t\r");
+            if (begin == std::string_view::npos) return {};
+
+            const usize end = text.find_last_not_of(" \t\r");
+            return text.substr(begin, end - begin + 1);
+        }
+
+        std::expected<InputBinding, std::string> ParseBinding(std::string_view text)
+        {
+            Modifier modifiers = Modifier::None;
+
+            usize plus;
+            while ((plus = text.find('+')) != std::string_view::npos) {
+                const std::string_view modifier = Trim(text.substr(0, plus));
+                text = text.substr(plus + 1);
+
+                if (modifier == "Shift") modifiers = modifiers | Modifier::Shift;
+                else if (modifier == "Control" || modifier == "Ctrl") modifiers = modifiers | Modifier::Control;
+                else if (modifier == "Alt") modifiers = modifiers | Modifier::Alt;
+                else if (modifier == "Super") modifiers = modifiers | Modifier::Super;
+                else return std::unexpected(std::string("Unknown modifier \"") + std::string(modifier) + "\"");
+            }
+
+            text = Trim(text);
+
+            for (const KeyName& entry : KeyNames) {
+                if (entry.name == text) return InputBinding::Key(entry.key, modifiers);
+            }
+
+            for (const ButtonName& entry : ButtonNames) {
+                if (entry.name == text) return InputBinding::Mouse(entry.button, modifiers);
+            }
+
+            return std::unexpected(std::string("Unknown key or button \"") + std::string(text) + "\"");
+        }
+
+        u8 GetHeldModifiers()
+        {
+            u8 modifiers = 0;
+
+            if (Input::IsKeyDown(KeyCode::LeftShift) || Input::IsKeyDown(KeyCode::RightShift)) {
+                modifiers |= static_cast<u8>(Modifier::Shift);
+            }
+            if (Input::IsKeyDown(KeyCode::LeftControl) || Input::IsKeyDown(KeyCode::RightControl)) {
+                modifiers |= static_cast<u8>(Modifier::Control);
+            }
+            if (Input::IsKeyDown(KeyCode::LeftAlt) || Input::IsKeyDown(KeyCode::RightAlt)) {
+                modifiers |= static_cast<u8>(Modifier::Alt);
+            }
+            if (Input::IsKeyDown(KeyCode::LeftSuper) || Input::IsKeyDown(KeyCode::RightSuper)) {
+                modifiers |= static_cast<u8>(Modifier::Super);
+            }
+
+            return modifiers;
+        }
+
+    }
+
+    ActionBindings& ActionBindings::BindAction(std::string_view action, InputBinding binding)
+    {
+        m_Actions.push_back(ActionEntry { std::string(action), binding });
+        return *this;
+    }
+
+    ActionBindings& ActionBindings::BindAxis(std::string_view axis, InputBinding binding, f32 scale)
+    {
+        m_Axes.push_back(AxisEntry { std::string(axis), binding, scale });
+        return *this;
+    }
+
+    std::expected<ActionBindings, std::string> ActionBindings::Parse(std::string_view text)
+    {
+        ActionBindings bindings;
+        usize lineNumber = 0;
+
+        while (!text.empty()) {
+            const usize newline = text.find('\n');
+            const std::string_view line = Trim(text.substr(0, newline));
+            text = newline == std::string_view::npos ? std::string_view() : text.substr(newline + 1);
+            ++lineNumber;
+
+            if (line.empty() || line.front() == '#') continue;
+
+            auto error = [&](std::string_view message) {
+                return std::unexpected(std::string("Line ") + std::to_string(lineNumber) + ": " + std::string(message));
+            };
+
+            const usize space = line.find_first_of(" \t");
+            const usize equals = line.find('=');
+            if (space == std::string_view::npos || equals == std::string_view::npos || equals < space) {
+                return error("expected \"action|axis <name> = <bindings>\"");
+            }
+
+            const std::string_view kind = line.substr(0, space);
+            const std::string_view name = Trim(line.substr(space, equals - space));
+            std::string_view list = line.substr(equals + 1);
+
+            if (name.empty()) return error("missing name");
+            if (kind != "action" && kind != "axis") return error("unknown entry kind");
+
+            while (!list.empty()) {
+                const usize comma = list.find(',');
+                std::string_view item = Trim(list.substr(0, comma));
+                list = comma == std::string_view::npos ? std::string_view() : list.substr(comma + 1);
+
+                if (item.empty()) continue;
+
+                f32 scale = 1.0f;
+                if (kind == "axis") {
+                    const usize colon = item.rfind(':');
+                    if (colon != std::string_view::npos) {
+                        const std::string_view value = Trim(item.substr(colon + 1));
+                        auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), scale);
+                        if (ec != std::errc() || ptr != value.data() + value.size()) {
+                            return error("invalid axis scale");
+                        }
+                        item = item.substr(0, colon);
+                    }
+                }
+
+                auto binding = ParseBinding(item);
+                if (!binding) return error(binding.error());
+
+                if (kind == "action") {
+                    bindings.BindAction(name, *binding);
+                } else {
+                    bindings.BindAxis(name, *binding, scale);
+                }
+            }
+        }
+
+        return bindings;
+    }
+
+    std::expected<ActionBindings, std::string> ActionBindings::LoadFromFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path);
+        if (!file) {
+            return std::unexpected("Failed to open " + path.string());
+        }
+
+        std::stringstream contents;
+        contents << file.rdbuf();
+
+        return Parse(contents.str());
+    }
+
+    ActionID InputActions::GetAction(std::string_view name)
+    {
+        return Intern(s_ActionNames, name, MaxActions, "action");
+    }
+
+    AxisID InputActions::GetAxis(std::string_view name)
+    {
+        return Intern(s_AxisNames, name, MaxAxes, "axis");
+    }
+
+    void InputActions::Load(const ActionBindings& bindings)
+    {
+        // Compile into fresh tables, Evaluate itself never allocates
+        std::vector<CompiledBinding> actions;
+        actions.reserve(bindings.m_Actions.size());
+
+        for (const auto& entry : bindings.m_Actions) {
+            actions.push_back(CompiledBinding {
+                .target = GetAction(entry.name),
+                .code = entry.binding.code,
+                .source = entry.binding.source,
+                .modifiers = static_cast<u8>(entry.binding.modifiers),
+                .scale = 1.0f
+            });
+        }
+
+        std::vector<CompiledBinding> axes;
+        axes.reserve(bindings.m_Axes.size());
+
+        for (const auto& entry : bindings.m_Axes) {
+            axes.push_back(CompiledBinding {
+                .target = GetAxis(entry.name),
+                .code = entry.binding.code,
+                .source = entry.binding.source,
+                .modifiers = static_cast<u8>(entry.binding.modifiers),
+                .scale = entry.scale
+            });
+        }
+
+        // Group bindings by target so evaluation walks memory linearly
+        auto byTarget = [](const CompiledBinding& a, const CompiledBinding& b) { return a.target < b.target; };
+        std::ranges::stable_sort(actions, byTarget);
+        std::ranges::stable_sort(axes, byTarget);
+
+        s_ActionBindings = std::move(actions);
+        s_AxisBindings = std::move(axes);
+
+        LOG_INFO("Loaded {} action and {} axis bindings", s_ActionBindings.size(), s_AxisBindings.size());
+    }
+
+    void InputActions::Evaluate()
+    {
+        const u8 held = GetHeldModifiers();
+
+        auto isActive = [held](const CompiledBinding& binding) {
+            if ((binding.modifiers & held) != binding.modifiers) return false;
+
+            return binding.source == InputBinding::Source::Key
+                ? Input::IsKeyDown(static_cast<KeyCode>(binding.code))
+                : Input::IsMouseButtonDown(static_cast<MouseButton>(binding.code));
+        };
+
+        ActionMask down {};
+        for (const CompiledBinding& binding : s_ActionBindings) {
+            if (isActive(binding)) {
+                down[binding.target >> 6] |= u64(1) << (binding.target & 63);
+            }
+        }
+
+        for (usize i = 0; i < down.size(); ++i) {
+            s_Pressed[i] = down[i] & ~s_Down[i];
+            s_Released[i] = s_Down[i] & ~down[i];
+            s_Down[i] = down[i];
+        }
+
+        s_AxisValues.fill(0.0f);
+        for (const CompiledBinding& binding : s_AxisBindings) {
+            if (isActive(binding)) {
+                s_AxisValues[binding.target] += binding.scale;
+            }
+        }
+
+        for (f32& value : s_AxisValues) {
+            value = std::clamp(value, -1.0f, 1.0f);
+        }
+    }
+
+    u16 InputActions::Intern(std::vector<std::string>& names, std::string_view name, usize capacity, const char* kind)
+    {
+        for (usize i = 0; i < names.size(); ++i) {
+            if (names[i] == name) return static_cast<u16>(i);
+        }
+
+        if (names.size() == capacity) {
+            LOG_ERROR("Too many input {}s, \"{}\" aliases the last one", kind, name);
+            return static_cast<u16>(capacity - 1);
+        }
+
+        names.emplace_back(name);
+        return static_cast<u16>(names.size() - 1);
+    }
+
+}
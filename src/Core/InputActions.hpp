@@ -0,0 +1,151 @@
+#pragma once
+
+#include "KeyCodes.hpp"
+
+namespace Core {
+
+    using ActionID = u16;
+    using AxisID = u16;
+
+    enum class Modifier : u8
+    {
+        None    = 0,
+        Shift   = 1 << 0,
+        Control = 1 << 1,
+        Alt     = 1 << 2,
+        Super   = 1 << 3
+    };
+
+    constexpr Modifier operator|(Modifier a, Modifier b) noexcept
+    {
+        return static_cast<Modifier>(static_cast<u8>(a) | static_cast<u8>(b));
+    }
+
+    struct InputBinding
+    {
+        enum class Source : u8
+        {
+            Key,
+            MouseButton
+        };
+
+        Source source = Source::Key;
+        u16 code = 0;
+        Modifier modifiers = Modifier::None;
+
+        static constexpr InputBinding Key(KeyCode key, Modifier modifiers = Modifier::None) noexcept
+        {
+            return InputBinding { Source::Key, static_cast<u16>(key), modifiers };
+        }
+
+        static constexpr InputBinding Mouse(MouseButton button, Modifier modifiers = Modifier::None) noexcept
+        {
+            return InputBinding { Source::MouseButton, static_cast<u16>(button), modifiers };
+        }
+    };
+
+    // Editable description of every binding. Building one allocates freely;
+    // InputActions::Load compiles it into the flat table that is evaluated each frame.
+    class ActionBindings
+    {
+        friend class InputActions;
+    public:
+        ActionBindings& BindAction(std::string_view action, InputBinding binding);
+        ActionBindings& BindAxis(std::string_view axis, InputBinding binding, f32 scale);
+
+        // Parses lines of the form:
+        //   action Quit = Escape
+        //   action Save = Control+S, Control+Mouse1
+        //   axis MoveX = D:1, A:-1, Right:1, Left:-1
+        // Blank lines and lines starting with '#' are ignored.
+        static std::expected<ActionBindings, std::string> Parse(std::string_view text);
+        static std::expected<ActionBindings, std::string> LoadFromFile(const std::filesystem::path& path);
+
+    private:
+        struct ActionEntry
+        {
+            std::string name;
+            InputBinding binding;
+        };
+
+        struct AxisEntry
+        {
+            std::string name;
+            InputBinding binding;
+            f32 scale;
+        };
+
+        std::vector<ActionEntry> m_Actions;
+        std::vector<AxisEntry> m_Axes;
+    };
+
+    class InputActions
+    {
+        friend class Application;
+    public:
+        static constexpr usize MaxActions = 256;
+        static constexpr usize MaxAxes = 64;
+
+    public:
+        // IDs are stable for the lifetime of the process, including across reloads
+        static ActionID GetAction(std::string_view name);
+        static AxisID GetAxis(std::string_view name);
+
+        static void Load(const ActionBindings& bindings);
+
+        [[nodiscard]] inline static bool IsDown(ActionID action) noexcept
+        {
+            return TestBit(s_Down, action);
+        }
+
+        [[nodiscard]] inline static bool IsPressed(ActionID action) noexcept
+        {
+            return TestBit(s_Pressed, action);
+        }
+
+        [[nodiscard]] inline static bool IsReleased(ActionID action) noexcept
+        {
+            return TestBit(s_Released, action);
+        }
+
+        [[nodiscard]] inline static f32 GetAxisValue(AxisID axis) noexcept
+        {
+            return s_AxisValues[axis];
+        }
+
+    protected:
+        static void Evaluate();
+
+    private:
+        using ActionMask = std::array<u64, MaxActions / 64>;
+
+        struct CompiledBinding
+        {
+            u16 target;
+            u16 code;
+            InputBinding::Source source;
+            u8 modifiers;
+            f32 scale;
+        };
+
+        [[nodiscard]] inline static bool TestBit(const ActionMask& mask, ActionID action) noexcept
+        {
+            return (mask[action >> 6] >> (action & 63)) & 1;
+        }
+
+        static u16 Intern(std::vector<std::string>& names, std::string_view name, usize capacity, const char* kind);
+
+    private:
+        inline static std::vector<std::string> s_ActionNames;
+        inline static std::vector<std::string> s_AxisNames;
+
+        inline static std::vector<CompiledBinding> s_ActionBindings;
+        inline static std::vector<CompiledBinding> s_AxisBindings;
+
+        inline static ActionMask s_Down {};
+        inline static ActionMask s_Pressed {};
+        inline static ActionMask s_Released {};
+        inline static std::array<f32, MaxAxes> s_AxisValues {};
+    };
+
+}
@@ -150,6 +150,41 @@ namespace Core {
         Middle = Button2
     };
 
+    enum class GamepadButton : u8
+    {
+        // From glfw3.h, Xbox layout
+        A = 0,
+        B = 1,
+        X = 2,
+        Y = 3,
+        LeftBumper = 4,
+        RightBumper = 5,
+        Back = 6,
+        Start = 7,
+        Guide = 8,
+        LeftThumb = 9,
+        RightThumb = 10,
+        DpadUp = 11,
+        DpadRight = 12,
+        DpadDown = 13,
+        DpadLeft = 14,
+
+        Cross = A,
+        Circle = B,
+        Square = X,
+        Triangle = Y
+    };
+
+    enum class GamepadAxis : u8
+    {
+        LeftX = 0,
+        LeftY = 1,
+        RightX = 2,
+        RightY = 3,
+        LeftTrigger = 4,
+        RightTrigger = 5
+    };
+
     enum class KeyState : i8
     {
         None = -1,
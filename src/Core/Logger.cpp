@@ -2,9 +2,74 @@
 
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/base_sink.h>
+#include <spdlog/pattern_formatter.h>
+
+#include "FlightRecorder.hpp"
+#include "Metrics/Metrics.hpp"
+#include "Threading.hpp"
+
+#if defined(__unix__)
+    #include "Logging/MappedRingSink.hpp"
+#endif
 
 namespace Core {
 
+    namespace {
+
+        class MetricsSink final : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+        {
+        protected:
+            void sink_it_(const spdlog::details::log_msg& msg) override
+            {
+                m_Messages.Increment();
+                if (msg.level >= spdlog::level::err) {
+                    m_Errors.Increment();
+                }
+            }
+
+            void flush_() override {}
+
+        private:
+            Metrics::Counter& m_Messages = Metrics::Registry::GetCounter("log.messages");
+            Metrics::Counter& m_Errors = Metrics::Registry::GetCounter("log.errors");
+        };
+
+        // %N: the thread's Threading name, or its id if it was never named
+        class ThreadNameFlag final : public spdlog::custom_flag_formatter
+        {
+        public:
+            void format(const spdlog::details::log_msg& msg, const std::tm&, spdlog::memory_buf_t& dest) override
+            {
+                const std::string_view name = Threading::GetThreadName();
+                if (name.empty()) {
+                    spdlog::details::fmt_helper::append_string_view("thread ", dest);
+                    spdlog::details::fmt_helper::append_int(msg.thread_id, dest);
+                } else {
+                    spdlog::details::fmt_helper::append_string_view(spdlog::string_view_t(name.data(), name.size()), dest);
+                }
+            }
+
+            std::unique_ptr<custom_flag_formatter> clone() const override
+            {
+                return std::make_unique<ThreadNameFlag>();
+            }
+        };
+
+        spdlog::sink_ptr CreateFileSink(const std::string& logDir)
+        {
+#if defined(__unix__)
+            try {
+                return std::make_shared<MappedRingSink>(logDir + "/Application.ring");
+            } catch (const spdlog::spdlog_ex& e) {
+                std::fprintf(stderr, "[Logger] %s, falling back to a plain log file\n", e.what());
+            }
+#endif
+            return std::make_shared<spdlog::sinks::basic_file_sink_mt>(logDir + "/Application.log", true);
+        }
+
+    }
+
     void Logger::Init()
     {
         if (s_Initialized) return;
@@ -16,17 +81,28 @@ namespace Core {
 
         std::vector<spdlog::sink_ptr> sinks {
             std::make_shared<spdlog::sinks::stdout_color_sink_mt>(),
-            std::make_shared<spdlog::sinks::basic_file_sink_mt>(logDir + "/Application.log", true)
+            CreateFileSink(logDir),
+            std::make_shared<MetricsSink>(),
+            std::make_shared<FlightRecorderSink>()
         };
 
         for (auto& sink : sinks) {
-            sink->set_pattern("[%H:%M:%S %z] [%^%l%$] [thread %t] %v");
+            auto formatter = std::make_unique<spdlog::pattern_formatter>();
+            formatter->add_flag<ThreadNameFlag>('N').set_pattern("[%H:%M:%S %z] [%^%l%$] [%N] %v");
+            sink->set_formatter(std::move(formatter));
         }
 
         auto logger = std::make_shared<spdlog::logger>("Application", sinks.begin(), sinks.end());
         logger->set_level(spdlog::level::trace);
         logger->flush_on(spdlog::level::err);
 
+        // Messages that fail to format or reach a sink are counted as dropped
+        logger->set_error_handler([](const std::string& message) {
+            static Metrics::Counter& dropped = Metrics::Registry::GetCounter("log.dropped");
+            dropped.Increment();
+            std::fprintf(stderr, "[Logger] %s\n", message.c_str());
+        });
+
         spdlog::register_logger(logger);
         spdlog::set_default_logger(logger);
 
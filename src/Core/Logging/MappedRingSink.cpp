@@ -0,0 +1,114 @@
+#include "MappedRingSink.hpp"
+
+#if defined(__unix__)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Core {
+
+    MappedRingSink::MappedRingSink(const std::filesystem::path& path, u64 capacity)
+        : m_MappingSize(GetRingLogFileSize(capacity)), m_Capacity(capacity)
+    {
+        i32 fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0) {
+            spdlog::throw_spdlog_ex("Failed to open ring log " + path.string(), errno);
+        }
+
+        struct stat info {};
+        if (fstat(fd, &info) != 0) {
+            const i32 error = errno;
+            close(fd);
+            spdlog::throw_spdlog_ex("Failed to stat ring log " + path.string(), error);
+        }
+        const bool reuse = static_cast<usize>(info.st_size) == m_MappingSize;
+
+        if (!reuse) {
+            if (ftruncate(fd, 0) != 0) {
+                const i32 error = errno;
+                close(fd);
+                spdlog::throw_spdlog_ex("Failed to truncate ring log " + path.string(), error);
+            }
+
+            // Returns the error instead of setting errno
+            if (const i32 error = posix_fallocate(fd, 0, static_cast<off_t>(m_MappingSize)); error != 0) {
+                close(fd);
+                spdlog::throw_spdlog_ex("Failed to preallocate ring log " + path.string(), error);
+            }
+        }
+
+        void* mapping = mmap(nullptr, m_MappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const i32 mapError = errno;
+        close(fd);
+
+        if (mapping == MAP_FAILED) {
+            spdlog::throw_spdlog_ex("Failed to map ring log " + path.string(), mapError);
+        }
+
+        m_Mapping = static_cast<std::byte*>(mapping);
+        m_Header = reinterpret_cast<RingLogHeader*>(m_Mapping);
+        m_Records = reinterpret_cast<RingLogRecord*>(m_Mapping + RingLogHeaderSize);
+
+        // Keep appending to a ring left by a previous run if its layout matches
+        const bool valid = reuse
+            && m_Header->magic == RingLogMagic
+            && m_Header->version == RingLogVersion
+            && m_Header->headerSize == RingLogHeaderSize
+            && m_Header->recordSize == RingLogRecordSize
+            && m_Header->capacity == m_Capacity;
+
+        if (!valid) {
+            std::memset(static_cast<void*>(m_Mapping), 0, m_MappingSize);
+
+            m_Header->magic = RingLogMagic;
+            m_Header->version = RingLogVersion;
+            m_Header->headerSize = RingLogHeaderSize;
+            m_Header->recordSize = RingLogRecordSize;
+            m_Header->capacity = m_Capacity;
+            m_Header->writeIndex.store(0, std::memory_order_release);
+        }
+    }
+
+    MappedRingSink::~MappedRingSink()
+    {
+        if (m_Mapping) {
+            munmap(m_Mapping, m_MappingSize);
+        }
+    }
+
+    void MappedRingSink::sink_it_(const spdlog::details::log_msg& msg)
+    {
+        spdlog::memory_buf_t formatted;
+        formatter_->format(msg, formatted);
+
+        usize length = formatted.size();
+        while (length > 0 && (formatted[length - 1] == '\n' || formatted[length - 1] == '\r')) {
+            --length;
+        }
+
+        const u64 index = m_Header->writeIndex.fetch_add(1, std::memory_order_relaxed);
+        RingLogRecord& record = m_Records[index % m_Capacity];
+
+        // Invalidate the slot while it is rewritten so readers never pair old text with a new sequence
+        record.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        length = std::min(length, sizeof(record.text));
+        record.timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(msg.time.time_since_epoch()).count();
+        record.length = static_cast<u16>(length);
+        record.level = static_cast<u8>(msg.level);
+        std::memcpy(record.text, formatted.data(), length);
+
+        record.sequence.store(index + 1, std::memory_order_release);
+    }
+
+    void MappedRingSink::flush_()
+    {
+        msync(m_Mapping, m_MappingSize, MS_ASYNC);
+    }
+
+}
+
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "RingLogLayout.hpp"
+
+#include <spdlog/sinks/base_sink.h>
+
+namespace Core {
+
+    // spdlog sink backed by a preallocated, memory-mapped file used as a ring of
+    // fixed-size records. Writing a message is a memcpy into the mapping; the
+    // kernel owns the dirty pages, so the log survives a crash of the process.
+    // Old records are overwritten once the ring wraps.
+    class MappedRingSink final : public spdlog::sinks::base_sink<std::mutex>
+    {
+    public:
+        static constexpr u64 DefaultCapacity = 16 * 1024;
+
+    public:
+        MappedRingSink(const std::filesystem::path& path, u64 capacity = DefaultCapacity);
+        ~MappedRingSink() override;
+
+        MappedRingSink(const MappedRingSink&) = delete;
+        MappedRingSink& operator=(const MappedRingSink&) = delete;
+
+    protected:
+        void sink_it_(const spdlog::details::log_msg& msg) override;
+        void flush_() override;
+
+    private:
+        std::byte* m_Mapping = nullptr;
+        usize m_MappingSize = 0;
+
+        RingLogHeader* m_Header = nullptr;
+        RingLogRecord* m_Records = nullptr;
+        u64 m_Capacity = 0;
+    };
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+// On-disk layout of the memory-mapped ring log written by MappedRingSink and
+// read by the LogReader tool. Bump RingLogVersion on any change to these structs.
+
+namespace Core {
+
+    inline constexpr u32 RingLogMagic = 0x474F4C52; // "RLOG"
+    inline constexpr u32 RingLogVersion = 1;
+
+    inline constexpr usize RingLogHeaderSize = 4096;
+    inline constexpr usize RingLogRecordSize = 256;
+
+    struct RingLogHeader
+    {
+        u32 magic;
+        u32 version;
+        u32 headerSize;
+        u32 recordSize;
+        u64 capacity;
+
+        // Total records ever claimed; record i lives in slot i % capacity
+        std::atomic<u64> writeIndex;
+    };
+
+    struct RingLogRecord
+    {
+        // Claim index + 1, written last. Zero or a mismatch means the slot is empty or torn.
+        std::atomic<u64> sequence;
+        i64 timestampNs;
+        u16 length;
+        u8 level;
+        u8 reserved[5];
+
+        char text[RingLogRecordSize - 24];
+    };
+
+    static_assert(sizeof(RingLogHeader) <= RingLogHeaderSize);
+    static_assert(sizeof(RingLogRecord) == RingLogRecordSize);
+
+    [[nodiscard]] constexpr usize GetRingLogFileSize(u64 capacity) noexcept
+    {
+        return RingLogHeaderSize + capacity * RingLogRecordSize;
+    }
+
+}
@@ -0,0 +1,300 @@
+#include "BatchKernels.hpp"
+
+#include "Core/CPUFeatures.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define MATH_HAS_SSE2 1
+#endif
+
+namespace Core::Math {
+
+    namespace {
+
+        void TransformPointsScalar(const Mat4& m, ConstVec3Arrays in, Vec3Arrays out, usize count) noexcept
+        {
+            for (usize i = 0; i < count; ++i) {
+                const Vec3 p = m.TransformPoint({ in.x[i], in.y[i], in.z[i] });
+                out.x[i] = p.x;
+                out.y[i] = p.y;
+                out.z[i] = p.z;
+            }
+        }
+
+        void DotScalar(ConstVec3Arrays a, ConstVec3Arrays b, f32* out, usize count) noexcept
+        {
+            for (usize i = 0; i < count; ++i) {
+                out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+            }
+        }
+
+        void CrossScalar(ConstVec3Arrays a, ConstVec3Arrays b, Vec3Arrays out, usize count) noexcept
+        {
+            for (usize i = 0; i < count; ++i) {
+                const Vec3 c = Math::Cross(Vec3 { a.x[i], a.y[i], a.z[i] }, Vec3 { b.x[i], b.y[i], b.z[i] });
+                out.x[i] = c.x;
+                out.y[i] = c.y;
+                out.z[i] = c.z;
+            }
+        }
+
+        usize OverlapAABBsScalar(const AABB& query, ConstAABBArrays boxes, u8* results, usize count) noexcept
+        {
+            usize overlaps = 0;
+
+            for (usize i = 0; i < count; ++i) {
+                const AABB box { { boxes.minX[i], boxes.minY[i], boxes.minZ[i] }, { boxes.maxX[i], boxes.maxY[i], boxes.maxZ[i] } };
+                results[i] = box.Overlaps(query) ? 1 : 0;
+                overlaps += results[i];
+            }
+
+            return overlaps;
+        }
+
+#if defined(MATH_HAS_SSE2)
+        constexpr usize Width = 4;
+
+        // Matrix element (row, column) broadcast to every lane
+        inline __m128 Splat(const Mat4& m, usize row, usize column) noexcept
+        {
+            const Vec4& c = m.columns[column];
+            return _mm_set1_ps(row == 0 ? c.x : row == 1 ? c.y : c.z);
+        }
+
+        void TransformPointsSSE2(const Mat4& m, ConstVec3Arrays in, Vec3Arrays out, usize count) noexcept
+        {
+            const __m128 m00 = Splat(m, 0, 0), m01 = Splat(m, 0, 1), m02 = Splat(m, 0, 2), m03 = Splat(m, 0, 3);
+            const __m128 m10 = Splat(m, 1, 0), m11 = Splat(m, 1, 1), m12 = Splat(m, 1, 2), m13 = Splat(m, 1, 3);
+            const __m128 m20 = Splat(m, 2, 0), m21 = Splat(m, 2, 1), m22 = Splat(m, 2, 2), m23 = Splat(m, 2, 3);
+
+            usize i = 0;
+            for (; i + Width <= count; i += Width) {
+                const __m128 x = _mm_loadu_ps(in.x + i);
+                const __m128 y = _mm_loadu_ps(in.y + i);
+                const __m128 z = _mm_loadu_ps(in.z + i);
+
+                // Same association as the scalar path: ((m0 * x + m1 * y) + m2 * z) + m3
+                const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_mul_ps(m02, z)), m03);
+                const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_mul_ps(m12, z)), m13);
+                const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_mul_ps(m22, z)), m23);
+
+                _mm_storeu_ps(out.x + i, rx);
+                _mm_storeu_ps(out.y + i, ry);
+                _mm_storeu_ps(out.z + i, rz);
+            }
+
+            TransformPointsScalar(m, { in.x + i, in.y + i, in.z + i }, { out.x + i, out.y + i, out.z + i }, count - i);
+        }
+
+        void DotSSE2(ConstVec3Arrays a, ConstVec3Arrays b, f32* out, usize count) noexcept
+        {
+            usize i = 0;
+            for (; i + Width <= count; i += Width) {
+                const __m128 x = _mm_mul_ps(_mm_loadu_ps(a.x + i), _mm_loadu_ps(b.x + i));
+                const __m128 y = _mm_mul_ps(_mm_loadu_ps(a.y + i), _mm_loadu_ps(b.y + i));
+                const __m128 z = _mm_mul_ps(_mm_loadu_ps(a.z + i), _mm_loadu_ps(b.z + i));
+                _mm_storeu_ps(out + i, _mm_add_ps(_mm_add_ps(x, y), z));
+            }
+
+            DotScalar({ a.x + i, a.y + i, a.z + i }, { b.x + i, b.y + i, b.z + i }, out + i, count - i);
+        }
+
+        void CrossSSE2(ConstVec3Arrays a, ConstVec3Arrays b, Vec3Arrays out, usize count) noexcept
+        {
+            usize i = 0;
+            for (; i + Width <= count; i += Width) {
+                const __m128 ax = _mm_loadu_ps(a.x + i), ay = _mm_loadu_ps(a.y + i), az = _mm_loadu_ps(a.z + i);
+                const __m128 bx = _mm_loadu_ps(b.x + i), by = _mm_loadu_ps(b.y + i), bz = _mm_loadu_ps(b.z + i);
+
+                _mm_storeu_ps(out.x + i, _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+                _mm_storeu_ps(out.y + i, _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)));
+                _mm_storeu_ps(out.z + i, _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+            }
+
+            CrossScalar({ a.x + i, a.y + i, a.z + i }, { b.x + i, b.y + i, b.z + i }, { out.x + i, out.y + i, out.z + i }, count - i);
+        }
+
+        usize OverlapAABBsSSE2(const AABB& query, ConstAABBArrays boxes, u8* results, usize count) noexcept
+        {
+            const __m128 qMinX = _mm_set1_ps(query.min.x), qMinY = _mm_set1_ps(query.min.y), qMinZ = _mm_set1_ps(query.min.z);
+            const __m128 qMaxX = _mm_set1_ps(query.max.x), qMaxY = _mm_set1_ps(query.max.y), qMaxZ = _mm_set1_ps(query.max.z);
+
+            usize overlaps = 0;
+            usize i = 0;
+
+            for (; i + Width <= count; i += Width) {
+                __m128 inside = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(boxes.minX + i), qMaxX), _mm_cmpge_ps(_mm_loadu_ps(boxes.maxX + i), qMinX));
+                inside = _mm_and_ps(inside, _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(boxes.minY + i), qMaxY), _mm_cmpge_ps(_mm_loadu_ps(boxes.maxY + i), qMinY)));
+                inside = _mm_and_ps(inside, _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(boxes.minZ + i), qMaxZ), _mm_cmpge_ps(_mm_loadu_ps(boxes.maxZ + i), qMinZ)));
+
+                const u32 mask = static_cast<u32>(_mm_movemask_ps(inside));
+                for (usize lane = 0; lane < Width; ++lane) {
+                    results[i + lane] = static_cast<u8>((mask >> lane) & 1);
+                }
+                overlaps += static_cast<usize>(std::popcount(mask));
+            }
+
+            const ConstAABBArrays rest { boxes.minX + i, boxes.minY + i, boxes.minZ + i, boxes.maxX + i, boxes.maxY + i, boxes.maxZ + i };
+            return overlaps + OverlapAABBsScalar(query, rest, results + i, count - i);
+        }
+#endif
+
+#if !defined(NDEBUG)
+        // Runs a level on fixed pseudo-random data and compares it with the
+        // scalar reference. Results may differ in the last bits where the
+        // kernel contracts a multiply-add, nothing more.
+        bool SelfCheck(SimdLevel level)
+        {
+            constexpr usize Count = 67; // Not a multiple of any width, so the tails run too
+
+            std::array<f32, Count * 12> data;
+            u32 state = 0x9E3779B9u;
+            for (f32& value : data) {
+                state = state * 1664525u + 1013904223u;
+                value = static_cast<f32>(state >> 8) / static_cast<f32>(1u << 24) * 20.0f - 10.0f;
+            }
+
+            const ConstVec3Arrays a { &data[0], &data[Count], &data[Count * 2] };
+            const ConstVec3Arrays b { &data[Count * 3], &data[Count * 4], &data[Count * 5] };
+            const ConstAABBArrays boxes {
+                &data[Count * 6], &data[Count * 7], &data[Count * 8],
+                &data[Count * 9], &data[Count * 10], &data[Count * 11]
+            };
+            const AABB query { { -3.0f, -3.0f, -3.0f }, { 4.0f, 4.0f, 4.0f } };
+            const Mat4 m = Mat4::FromTRS({ 1.0f, -2.0f, 3.0f }, Quat::FromAxisAngle({ 1.0f, 2.0f, 3.0f }, 0.7f), { 2.0f, 0.5f, 1.5f });
+
+            const BatchKernels& reference = Kernels::Scalar;
+            const BatchKernels& kernels = GetBatchKernels(level);
+
+            std::array<f32, Count * 3> expected, actual;
+            const Vec3Arrays expectedOut { &expected[0], &expected[Count], &expected[Count * 2] };
+            const Vec3Arrays actualOut { &actual[0], &actual[Count], &actual[Count * 2] };
+
+            const auto matches = [&](usize values) {
+                for (usize i = 0; i < values; ++i) {
+                    if (std::abs(expected[i] - actual[i]) > 1e-4f * std::max(1.0f, std::abs(expected[i]))) return false;
+                }
+                return true;
+            };
+
+            bool passed = true;
+
+            reference.transformPoints(m, a, expectedOut, Count);
+            kernels.transformPoints(m, a, actualOut, Count);
+            passed &= matches(Count * 3);
+
+            reference.cross(a, b, expectedOut, Count);
+            kernels.cross(a, b, actualOut, Count);
+            passed &= matches(Count * 3);
+
+            reference.dot(a, b, expected.data(), Count);
+            kernels.dot(a, b, actual.data(), Count);
+            passed &= matches(Count);
+
+            std::array<u8, Count> expectedHits, actualHits;
+            const usize expectedCount = reference.overlapAABBs(query, boxes, expectedHits.data(), Count);
+            const usize actualCount = kernels.overlapAABBs(query, boxes, actualHits.data(), Count);
+            passed &= expectedCount == actualCount && expectedHits == actualHits;
+
+            return passed;
+        }
+#endif
+
+    }
+
+    namespace Kernels {
+
+        const BatchKernels Scalar {
+            .transformPoints = &TransformPointsScalar,
+            .dot = &DotScalar,
+            .cross = &CrossScalar,
+            .overlapAABBs = &OverlapAABBsScalar
+        };
+
+#if defined(MATH_HAS_SSE2)
+        const BatchKernels SSE2 {
+            .transformPoints = &TransformPointsSSE2,
+            .dot = &DotSSE2,
+            .cross = &CrossSSE2,
+            .overlapAABBs = &OverlapAABBsSSE2
+        };
+#else
+        const BatchKernels SSE2 = Scalar;
+#endif
+
+    }
+
+    const BatchKernels& GetBatchKernels(SimdLevel level) noexcept
+    {
+        switch (level) {
+            case SimdLevel::AVX512: return Kernels::AVX512;
+            case SimdLevel::AVX2: return Kernels::AVX2;
+            case SimdLevel::SSE2: return Kernels::SSE2;
+            default: return Kernels::Scalar;
+        }
+    }
+
+    std::string_view GetSimdLevelName(SimdLevel level) noexcept
+    {
+        switch (level) {
+            case SimdLevel::AVX512: return "avx512";
+            case SimdLevel::AVX2: return "avx2";
+            case SimdLevel::SSE2: return "sse2";
+            default: return "scalar";
+        }
+    }
+
+    bool IsSimdLevelSupported(SimdLevel level) noexcept
+    {
+        const CPUFeatures& features = CPUFeatures::Get();
+
+        switch (level) {
+#if defined(MATH_HAS_SSE2)
+            case SimdLevel::AVX512: return features.avx512f;
+            case SimdLevel::AVX2: return features.avx2 && features.fma;
+            case SimdLevel::SSE2: return features.sse2;
+#else
+            case SimdLevel::AVX512:
+            case SimdLevel::AVX2:
+            case SimdLevel::SSE2: return false;
+#endif
+            default: return true;
+        }
+    }
+
+    SimdLevel GetBestSimdLevel() noexcept
+    {
+        if (IsSimdLevelSupported(SimdLevel::AVX512)) return SimdLevel::AVX512;
+        if (IsSimdLevelSupported(SimdLevel::AVX2)) return SimdLevel::AVX2;
+        if (IsSimdLevelSupported(SimdLevel::SSE2)) return SimdLevel::SSE2;
+        return SimdLevel::Scalar;
+    }
+
+    SimdLevel GetActiveSimdLevel() noexcept
+    {
+        static const SimdLevel level = [] {
+            SimdLevel best = GetBestSimdLevel();
+
+#if !defined(NDEBUG)
+            for (SimdLevel candidate : { SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512 }) {
+                if (IsSimdLevelSupported(candidate) && !SelfCheck(candidate)) {
+                    LOG_ERROR("Math: {} batch kernels disagree with the scalar reference", GetSimdLevelName(candidate));
+                    if (candidate <= best) best = SimdLevel::Scalar;
+                }
+            }
+#endif
+
+            LOG_DEBUG("Math: using {} batch kernels", GetSimdLevelName(best));
+            return best;
+        }();
+
+        return level;
+    }
+
+    const BatchKernels& GetActiveBatchKernels() noexcept
+    {
+        static const BatchKernels& kernels = GetBatchKernels(GetActiveSimdLevel());
+        return kernels;
+    }
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+// BatchKernelsAVX2.cpp and BatchKernelsAVX512.cpp are compiled with their
+// own instruction set flags and without the precompiled header.
+
+#include <string_view>
+
+#include "Matrix.hpp"
+
+namespace Core::Math {
+
+    // Structure-of-arrays views. Kernels read and write count elements through
+    // each pointer; outputs may alias inputs exactly but must not partially overlap.
+    struct Vec3Arrays
+    {
+        f32* x;
+        f32* y;
+        f32* z;
+    };
+
+    struct ConstVec3Arrays
+    {
+        const f32* x;
+        const f32* y;
+        const f32* z;
+
+        constexpr ConstVec3Arrays(const f32* x, const f32* y, const f32* z) noexcept
+            : x(x), y(y), z(z) {}
+
+        constexpr ConstVec3Arrays(Vec3Arrays arrays) noexcept
+            : x(arrays.x), y(arrays.y), z(arrays.z) {}
+    };
+
+    struct ConstAABBArrays
+    {
+        const f32* minX;
+        const f32* minY;
+        const f32* minZ;
+        const f32* maxX;
+        const f32* maxY;
+        const f32* maxZ;
+    };
+
+    enum class SimdLevel : u8
+    {
+        Scalar,
+        SSE2,
+        AVX2,
+        AVX512
+    };
+
+    struct BatchKernels
+    {
+        // out[i] = (m * (in[i], 1)).xyz
+        void (*transformPoints)(const Mat4& m, ConstVec3Arrays in, Vec3Arrays out, usize count) noexcept;
+        void (*dot)(ConstVec3Arrays a, ConstVec3Arrays b, f32* out, usize count) noexcept;
+        void (*cross)(ConstVec3Arrays a, ConstVec3Arrays b, Vec3Arrays out, usize count) noexcept;
+
+        // results[i] = 1 if box i overlaps query, else 0. Returns the number of overlaps.
+        usize (*overlapAABBs)(const AABB& query, ConstAABBArrays boxes, u8* results, usize count) noexcept;
+    };
+
+    namespace Kernels {
+
+        // The scalar table is the reference the SIMD variants are checked against
+        extern const BatchKernels Scalar;
+        extern const BatchKernels SSE2;
+        extern const BatchKernels AVX2;
+        extern const BatchKernels AVX512;
+
+    }
+
+    [[nodiscard]] const BatchKernels& GetBatchKernels(SimdLevel level) noexcept;
+    [[nodiscard]] std::string_view GetSimdLevelName(SimdLevel level) noexcept;
+
+    [[nodiscard]] bool IsSimdLevelSupported(SimdLevel level) noexcept;
+    [[nodiscard]] SimdLevel GetBestSimdLevel() noexcept;
+
+    // The widest supported level, picked on first use. Debug builds compare
+    // every supported level against the scalar reference at that point.
+    [[nodiscard]] SimdLevel GetActiveSimdLevel() noexcept;
+    [[nodiscard]] const BatchKernels& GetActiveBatchKernels() noexcept;
+
+    inline void TransformPoints(const Mat4& m, ConstVec3Arrays in, Vec3Arrays out, usize count) noexcept
+    {
+        GetActiveBatchKernels().transformPoints(m, in, out, count);
+    }
+
+    inline void Dot(ConstVec3Arrays a, ConstVec3Arrays b, f32* out, usize count) noexcept
+    {
+        GetActiveBatchKernels().dot(a, b, out, count);
+    }
+
+    inline void Cross(ConstVec3Arrays a, ConstVec3Arrays b, Vec3Arrays out, usize count) noexcept
+    {
+        GetActiveBatchKernels().cross(a, b, out, count);
+    }
+
+    inline usize OverlapAABBs(const AABB& query, ConstAABBArrays boxes, u8* results, usize count) noexcept
+    {
+        return GetActiveBatchKernels().overlapAABBs(query, boxes, results, count);
+    }
+
+}
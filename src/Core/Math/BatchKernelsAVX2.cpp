@@ -0,0 +1,171 @@
+// Built with -mavx2 -mfma (/arch:AVX2 on MSVC) and without the precompiled
+// header, see CMakeLists.txt. Only selected after IsSimdLevelSupported checked the CPU.
+
+#include "BatchKernels.hpp"
+
+#include <bit>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+namespace Core::Math {
+
+#if defined(__AVX2__)
+    namespace {
+
+        constexpr usize Width = 8;
+
+        // Lanes [0, count) set, for the partial block at the end of each array
+        inline __m256i TailMask(usize count) noexcept
+        {
+            const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<i32>(count)), lanes);
+        }
+
+        struct AffineRows
+        {
+            __m256 m[3][4];
+
+            explicit AffineRows(const Mat4& matrix) noexcept
+            {
+                for (usize column = 0; column < 4; ++column) {
+                    const Vec4& c = matrix.columns[column];
+                    m[0][column] = _mm256_set1_ps(c.x);
+                    m[1][column] = _mm256_set1_ps(c.y);
+                    m[2][column] = _mm256_set1_ps(c.z);
+                }
+            }
+
+            inline __m256 Row(usize row, __m256 x, __m256 y, __m256 z) const noexcept
+            {
+                return _mm256_fmadd_ps(m[row][2], z, _mm256_fmadd_ps(m[row][1], y, _mm256_fmadd_ps(m[row][0], x, m[row][3])));
+            }
+        };
+
+        void TransformPointsAVX2(const Mat4& matrix, ConstVec3Arrays in, Vec3Arrays out, usize count) noexcept
+        {
+            const AffineRows rows(matrix);
+
+            usize i = 0;
+            for (; i + Width <= count; i += Width) {
+                const __m256 x = _mm256_loadu_ps(in.x + i);
+                const __m256 y = _mm256_loadu_ps(in.y + i);
+                const __m256 z = _mm256_loadu_ps(in.z + i);
+
+                _mm256_storeu_ps(out.x + i, rows.Row(0, x, y, z));
+                _mm256_storeu_ps(out.y + i, rows.Row(1, x, y, z));
+                _mm256_storeu_ps(out.z + i, rows.Row(2, x, y, z));
+            }
+
+            if (i < count) {
+                const __m256i mask = TailMask(count - i);
+                const __m256 x = _mm256_maskload_ps(in.x + i, mask);
+                const __m256 y = _mm256_maskload_ps(in.y + i, mask);
+                const __m256 z = _mm256_maskload_ps(in.z + i, mask);
+
+                _mm256_maskstore_ps(out.x + i, mask, rows.Row(0, x, y, z));
+                _mm256_maskstore_ps(out.y + i, mask, rows.Row(1, x, y, z));
+                _mm256_maskstore_ps(out.z + i, mask, rows.Row(2, x, y, z));
+            }
+        }
+
+        inline __m256 Dot(__m256 ax, __m256 ay, __m256 az, __m256 bx, __m256 by, __m256 bz) noexcept
+        {
+            return _mm256_fmadd_ps(az, bz, _mm256_fmadd_ps(ay, by, _mm256_mul_ps(ax, bx)));
+        }
+
+        void DotAVX2(ConstVec3Arrays a, ConstVec3Arrays b, f32* out, usize count) noexcept
+        {
+            usize i = 0;
+            for (; i + Width <= count; i += Width) {
+                _mm256_storeu_ps(out + i, Dot(
+                    _mm256_loadu_ps(a.x + i), _mm256_loadu_ps(a.y + i), _mm256_loadu_ps(a.z + i),
+                    _mm256_loadu_ps(b.x + i), _mm256_loadu_ps(b.y + i), _mm256_loadu_ps(b.z + i)));
+            }
+
+            if (i < count) {
+                const __m256i mask = TailMask(count - i);
+                _mm256_maskstore_ps(out + i, mask, Dot(
+                    _mm256_maskload_ps(a.x + i, mask), _mm256_maskload_ps(a.y + i, mask), _mm256_maskload_ps(a.z + i, mask),
+                    _mm256_maskload_ps(b.x + i, mask), _mm256_maskload_ps(b.y + i, mask), _mm256_maskload_ps(b.z + i, mask)));
+            }
+        }
+
+        void CrossAVX2(ConstVec3Arrays a, ConstVec3Arrays b, Vec3Arrays out, usize count) noexcept
+        {
+            const auto cross = [&](usize i, auto load, auto store) {
+                const __m256 ax = load(a.x + i), ay = load(a.y + i), az = load(a.z + i);
+                const __m256 bx = load(b.x + i), by = load(b.y + i), bz = load(b.z + i);
+
+                store(out.x + i, _mm256_fmsub_ps(ay, bz, _mm256_mul_ps(az, by)));
+                store(out.y + i, _mm256_fmsub_ps(az, bx, _mm256_mul_ps(ax, bz)));
+                store(out.z + i, _mm256_fmsub_ps(ax, by, _mm256_mul_ps(ay, bx)));
+            };
+
+            usize i = 0;
+            for (; i + Width <= count; i += Width) {
+                cross(i,
+                    [](const f32* p) { return _mm256_loadu_ps(p); },
+                    [](f32* p, __m256 v) { _mm256_storeu_ps(p, v); });
+            }
+
+            if (i < count) {
+                const __m256i mask = TailMask(count - i);
+                cross(i,
+                    [mask](const f32* p) { return _mm256_maskload_ps(p, mask); },
+                    [mask](f32* p, __m256 v) { _mm256_maskstore_ps(p, mask, v); });
+            }
+        }
+
+        usize OverlapAABBsAVX2(const AABB& query, ConstAABBArrays boxes, u8* results, usize count) noexcept
+        {
+            const __m256 qMinX = _mm256_set1_ps(query.min.x), qMinY = _mm256_set1_ps(query.min.y), qMinZ = _mm256_set1_ps(query.min.z);
+            const __m256 qMaxX = _mm256_set1_ps(query.max.x), qMaxY = _mm256_set1_ps(query.max.y), qMaxZ = _mm256_set1_ps(query.max.z);
+
+            const auto test = [&](usize i, auto load) {
+                __m256 inside = _mm256_and_ps(_mm256_cmp_ps(load(boxes.minX + i), qMaxX, _CMP_LE_OQ), _mm256_cmp_ps(load(boxes.maxX + i), qMinX, _CMP_GE_OQ));
+                inside = _mm256_and_ps(inside, _mm256_and_ps(_mm256_cmp_ps(load(boxes.minY + i), qMaxY, _CMP_LE_OQ), _mm256_cmp_ps(load(boxes.maxY + i), qMinY, _CMP_GE_OQ)));
+                inside = _mm256_and_ps(inside, _mm256_and_ps(_mm256_cmp_ps(load(boxes.minZ + i), qMaxZ, _CMP_LE_OQ), _mm256_cmp_ps(load(boxes.maxZ + i), qMinZ, _CMP_GE_OQ)));
+                return static_cast<u32>(_mm256_movemask_ps(inside));
+            };
+
+            const auto store = [results](usize i, u32 mask, usize lanes) {
+                for (usize lane = 0; lane < lanes; ++lane) {
+                    results[i + lane] = static_cast<u8>((mask >> lane) & 1);
+                }
+            };
+
+            usize overlaps = 0;
+            usize i = 0;
+
+            for (; i + Width <= count; i += Width) {
+                const u32 mask = test(i, [](const f32* p) { return _mm256_loadu_ps(p); });
+                store(i, mask, Width);
+                overlaps += static_cast<usize>(std::popcount(mask));
+            }
+
+            if (i < count) {
+                const usize lanes = count - i;
+                const __m256i tail = TailMask(lanes);
+                const u32 mask = test(i, [tail](const f32* p) { return _mm256_maskload_ps(p, tail); }) & ((1u << lanes) - 1);
+                store(i, mask, lanes);
+                overlaps += static_cast<usize>(std::popcount(mask));
+            }
+
+            return overlaps;
+        }
+
+    }
+
+    const BatchKernels Kernels::AVX2 {
+        .transformPoints = &TransformPointsAVX2,
+        .dot = &DotAVX2,
+        .cross = &CrossAVX2,
+        .overlapAABBs = &OverlapAABBsAVX2
+    };
+#else
+    const BatchKernels Kernels::AVX2 = Kernels::Scalar;
+#endif
+
+}
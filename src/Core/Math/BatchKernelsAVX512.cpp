@@ -0,0 +1,131 @@
+// Built with -mavx512f -mfma (/arch:AVX512 on MSVC) and without the precompiled
+// header, see CMakeLists.txt. Only selected after IsSimdLevelSupported checked the CPU.
+
+#include "BatchKernels.hpp"
+
+#include <bit>
+
+#if defined(__AVX512F__)
+    #include <immintrin.h>
+#endif
+
+namespace Core::Math {
+
+#if defined(__AVX512F__)
+    namespace {
+
+        constexpr usize Width = 16;
+
+        inline __mmask16 TailMask(usize count) noexcept
+        {
+            return static_cast<__mmask16>((1u << count) - 1);
+        }
+
+        struct AffineRows
+        {
+            __m512 m[3][4];
+
+            explicit AffineRows(const Mat4& matrix) noexcept
+            {
+                for (usize column = 0; column < 4; ++column) {
+                    const Vec4& c = matrix.columns[column];
+                    m[0][column] = _mm512_set1_ps(c.x);
+                    m[1][column] = _mm512_set1_ps(c.y);
+                    m[2][column] = _mm512_set1_ps(c.z);
+                }
+            }
+
+            inline __m512 Row(usize row, __m512 x, __m512 y, __m512 z) const noexcept
+            {
+                return _mm512_fmadd_ps(m[row][2], z, _mm512_fmadd_ps(m[row][1], y, _mm512_fmadd_ps(m[row][0], x, m[row][3])));
+            }
+        };
+
+        // Full blocks use an all-ones mask, the tail block the partial one.
+        // Masked-off lanes are neither read nor written.
+        void TransformPointsAVX512(const Mat4& matrix, ConstVec3Arrays in, Vec3Arrays out, usize count) noexcept
+        {
+            const AffineRows rows(matrix);
+
+            for (usize i = 0; i < count; i += Width) {
+                const __mmask16 mask = count - i >= Width ? __mmask16(0xFFFF) : TailMask(count - i);
+                const __m512 x = _mm512_maskz_loadu_ps(mask, in.x + i);
+                const __m512 y = _mm512_maskz_loadu_ps(mask, in.y + i);
+                const __m512 z = _mm512_maskz_loadu_ps(mask, in.z + i);
+
+                _mm512_mask_storeu_ps(out.x + i, mask, rows.Row(0, x, y, z));
+                _mm512_mask_storeu_ps(out.y + i, mask, rows.Row(1, x, y, z));
+                _mm512_mask_storeu_ps(out.z + i, mask, rows.Row(2, x, y, z));
+            }
+        }
+
+        void DotAVX512(ConstVec3Arrays a, ConstVec3Arrays b, f32* out, usize count) noexcept
+        {
+            for (usize i = 0; i < count; i += Width) {
+                const __mmask16 mask = count - i >= Width ? __mmask16(0xFFFF) : TailMask(count - i);
+                const __m512 x = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, a.x + i), _mm512_maskz_loadu_ps(mask, b.x + i));
+                const __m512 y = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a.y + i), _mm512_maskz_loadu_ps(mask, b.y + i), x);
+                const __m512 z = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a.z + i), _mm512_maskz_loadu_ps(mask, b.z + i), y);
+                _mm512_mask_storeu_ps(out + i, mask, z);
+            }
+        }
+
+        void CrossAVX512(ConstVec3Arrays a, ConstVec3Arrays b, Vec3Arrays out, usize count) noexcept
+        {
+            for (usize i = 0; i < count; i += Width) {
+                const __mmask16 mask = count - i >= Width ? __mmask16(0xFFFF) : TailMask(count - i);
+                const __m512 ax = _mm512_maskz_loadu_ps(mask, a.x + i), ay = _mm512_maskz_loadu_ps(mask, a.y + i), az = _mm512_maskz_loadu_ps(mask, a.z + i);
+                const __m512 bx = _mm512_maskz_loadu_ps(mask, b.x + i), by = _mm512_maskz_loadu_ps(mask, b.y + i), bz = _mm512_maskz_loadu_ps(mask, b.z + i);
+
+                _mm512_mask_storeu_ps(out.x + i, mask, _mm512_fmsub_ps(ay, bz, _mm512_mul_ps(az, by)));
+                _mm512_mask_storeu_ps(out.y + i, mask, _mm512_fmsub_ps(az, bx, _mm512_mul_ps(ax, bz)));
+                _mm512_mask_storeu_ps(out.z + i, mask, _mm512_fmsub_ps(ax, by, _mm512_mul_ps(ay, bx)));
+            }
+        }
+
+        usize OverlapAABBsAVX512(const AABB& query, ConstAABBArrays boxes, u8* results, usize count) noexcept
+        {
+            const __m512 qMinX = _mm512_set1_ps(query.min.x), qMinY = _mm512_set1_ps(query.min.y), qMinZ = _mm512_set1_ps(query.min.z);
+            const __m512 qMaxX = _mm512_set1_ps(query.max.x), qMaxY = _mm512_set1_ps(query.max.y), qMaxZ = _mm512_set1_ps(query.max.z);
+            const __m512i one = _mm512_set1_epi32(1);
+
+            usize overlaps = 0;
+
+            for (usize i = 0; i < count; i += Width) {
+                const __mmask16 mask = count - i >= Width ? __mmask16(0xFFFF) : TailMask(count - i);
+
+                // Each compare only keeps lanes the previous one passed
+                __mmask16 inside = _mm512_mask_cmp_ps_mask(mask, _mm512_maskz_loadu_ps(mask, boxes.minX + i), qMaxX, _CMP_LE_OQ);
+                inside = _mm512_mask_cmp_ps_mask(inside, _mm512_maskz_loadu_ps(mask, boxes.maxX + i), qMinX, _CMP_GE_OQ);
+                inside = _mm512_mask_cmp_ps_mask(inside, _mm512_maskz_loadu_ps(mask, boxes.minY + i), qMaxY, _CMP_LE_OQ);
+                inside = _mm512_mask_cmp_ps_mask(inside, _mm512_maskz_loadu_ps(mask, boxes.maxY + i), qMinY, _CMP_GE_OQ);
+                inside = _mm512_mask_cmp_ps_mask(inside, _mm512_maskz_loadu_ps(mask, boxes.minZ + i), qMaxZ, _CMP_LE_OQ);
+                inside = _mm512_mask_cmp_ps_mask(inside, _mm512_maskz_loadu_ps(mask, boxes.maxZ + i), qMinZ, _CMP_GE_OQ);
+
+                // Narrow the 0/1 lanes to bytes, the tail store skips lanes past count
+                const __m512i lanes = _mm512_maskz_mov_epi32(inside, one);
+                if (mask == 0xFFFF) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(results + i), _mm512_cvtepi32_epi8(lanes));
+                } else {
+                    _mm512_mask_cvtepi32_storeu_epi8(results + i, mask, lanes);
+                }
+
+                overlaps += static_cast<usize>(std::popcount(static_cast<u32>(inside)));
+            }
+
+            return overlaps;
+        }
+
+    }
+
+    const BatchKernels Kernels::AVX512 {
+        .transformPoints = &TransformPointsAVX512,
+        .dot = &DotAVX512,
+        .cross = &CrossAVX512,
+        .overlapAABBs = &OverlapAABBsAVX512
+    };
+#else
+    const BatchKernels Kernels::AVX512 = Kernels::Scalar;
+#endif
+
+}
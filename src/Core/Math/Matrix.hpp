@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Quaternion.hpp"
+
+namespace Core::Math {
+
+    // Column-major 4x4 matrix acting on column vectors, so A * B applies B first.
+    // Conventions match the software renderer: right handed, camera looking
+    // down -Z, clip depth in [0, 1].
+    struct Mat4
+    {
+        Vec4 columns[4] {
+            { 1.0f, 0.0f, 0.0f, 0.0f },
+            { 0.0f, 1.0f, 0.0f, 0.0f },
+            { 0.0f, 0.0f, 1.0f, 0.0f },
+            { 0.0f, 0.0f, 0.0f, 1.0f }
+        };
+
+        [[nodiscard]] static constexpr Mat4 Identity() noexcept { return Mat4 {}; }
+
+        [[nodiscard]] static constexpr Mat4 Translation(Vec3 offset) noexcept
+        {
+            Mat4 result;
+            result.columns[3] = Vec4(offset, 1.0f);
+            return result;
+        }
+
+        [[nodiscard]] static constexpr Mat4 Scale(Vec3 scale) noexcept
+        {
+            Mat4 result;
+            result.columns[0].x = scale.x;
+            result.columns[1].y = scale.y;
+            result.columns[2].z = scale.z;
+            return result;
+        }
+
+        [[nodiscard]] static constexpr Mat4 Rotation(const Quat& q) noexcept
+        {
+            const f32 xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+            const f32 xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+            const f32 wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+            Mat4 result;
+            result.columns[0] = { 1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f };
+            result.columns[1] = { 2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f };
+            result.columns[2] = { 2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f };
+            return result;
+        }
+
+        // Scale, then rotate, then translate
+        [[nodiscard]] static constexpr Mat4 FromTRS(Vec3 translation, const Quat& rotation, Vec3 scale) noexcept
+        {
+            Mat4 result = Rotation(rotation);
+            result.columns[0] *= scale.x;
+            result.columns[1] *= scale.y;
+            result.columns[2] *= scale.z;
+            result.columns[3] = Vec4(translation, 1.0f);
+            return result;
+        }
+
+        [[nodiscard]] static inline Mat4 Perspective(f32 fovY, f32 aspect, f32 near, f32 far) noexcept
+        {
+            const f32 focal = 1.0f / std::tan(fovY * 0.5f);
+
+            Mat4 result;
+            result.columns[0] = { focal / aspect, 0.0f, 0.0f, 0.0f };
+            result.columns[1] = { 0.0f, focal, 0.0f, 0.0f };
+            result.columns[2] = { 0.0f, 0.0f, far / (near - far), -1.0f };
+            result.columns[3] = { 0.0f, 0.0f, near * far / (near - far), 0.0f };
+            return result;
+        }
+
+        [[nodiscard]] static inline Mat4 LookAt(Vec3 eye, Vec3 target, Vec3 up) noexcept
+        {
+            const Vec3 forward = Normalize(target - eye);
+            const Vec3 right = Normalize(Cross(forward, up));
+            const Vec3 trueUp = Cross(right, forward);
+
+            Mat4 result;
+            result.columns[0] = { right.x, trueUp.x, -forward.x, 0.0f };
+            result.columns[1] = { right.y, trueUp.y, -forward.y, 0.0f };
+            result.columns[2] = { right.z, trueUp.z, -forward.z, 0.0f };
+            result.columns[3] = { -Dot(right, eye), -Dot(trueUp, eye), Dot(forward, eye), 1.0f };
+            return result;
+        }
+
+        [[nodiscard]] constexpr Vec4 GetRow(usize row) const noexcept
+        {
+            const auto pick = [row](const Vec4& column) {
+                return row == 0 ? column.x : row == 1 ? column.y : row == 2 ? column.z : column.w;
+            };
+            return { pick(columns[0]), pick(columns[1]), pick(columns[2]), pick(columns[3]) };
+        }
+
+        constexpr Vec4 operator*(const Vec4& v) const noexcept
+        {
+            return columns[0] * v.x + columns[1] * v.y + columns[2] * v.z + columns[3] * v.w;
+        }
+
+        constexpr Mat4 operator*(const Mat4& other) const noexcept
+        {
+            Mat4 result;
+            for (usize i = 0; i < 4; ++i) {
+                result.columns[i] = *this * other.columns[i];
+            }
+            return result;
+        }
+
+        constexpr bool operator==(const Mat4& other) const noexcept
+        {
+            return columns[0] == other.columns[0] && columns[1] == other.columns[1]
+                && columns[2] == other.columns[2] && columns[3] == other.columns[3];
+        }
+
+        // Affine transform, the projective row is ignored
+        [[nodiscard]] constexpr Vec3 TransformPoint(Vec3 p) const noexcept
+        {
+            return (columns[0] * p.x + columns[1] * p.y + columns[2] * p.z + columns[3]).XYZ();
+        }
+
+        [[nodiscard]] constexpr Vec3 TransformDirection(Vec3 d) const noexcept
+        {
+            return (columns[0] * d.x + columns[1] * d.y + columns[2] * d.z).XYZ();
+        }
+    };
+
+    [[nodiscard]] constexpr Mat4 Transpose(const Mat4& m) noexcept
+    {
+        Mat4 result;
+        for (usize i = 0; i < 4; ++i) {
+            result.columns[i] = m.GetRow(i);
+        }
+        return result;
+    }
+
+    // General inverse by cofactors. A singular matrix returns the identity.
+    [[nodiscard]] constexpr Mat4 Inverse(const Mat4& m) noexcept
+    {
+        const Vec4& c0 = m.columns[0];
+        const Vec4& c1 = m.columns[1];
+        const Vec4& c2 = m.columns[2];
+        const Vec4& c3 = m.columns[3];
+
+        const f32 s0 = c0.x * c1.y - c1.x * c0.y;
+        const f32 s1 = c0.x * c1.z - c1.x * c0.z;
+        const f32 s2 = c0.x * c1.w - c1.x * c0.w;
+        const f32 s3 = c0.y * c1.z - c1.y * c0.z;
+        const f32 s4 = c0.y * c1.w - c1.y * c0.w;
+        const f32 s5 = c0.z * c1.w - c1.z * c0.w;
+
+        const f32 t5 = c2.z * c3.w - c3.z * c2.w;
+        const f32 t4 = c2.y * c3.w - c3.y * c2.w;
+        const f32 t3 = c2.y * c3.z - c3.y * c2.z;
+        const f32 t2 = c2.x * c3.w - c3.x * c2.w;
+        const f32 t1 = c2.x * c3.z - c3.x * c2.z;
+        const f32 t0 = c2.x * c3.y - c3.x * c2.y;
+
+        const f32 determinant = s0 * t5 - s1 * t4 + s2 * t3 + s3 * t2 - s4 * t1 + s5 * t0;
+        if (determinant == 0.0f) return Mat4 {};
+
+        const f32 inverse = 1.0f / determinant;
+
+        Mat4 result;
+        result.columns[0] = {
+            ( c1.y * t5 - c1.z * t4 + c1.w * t3) * inverse,
+            (-c0.y * t5 + c0.z * t4 - c0.w * t3) * inverse,
+            ( c3.y * s5 - c3.z * s4 + c3.w * s3) * inverse,
+            (-c2.y * s5 + c2.z * s4 - c2.w * s3) * inverse
+        };
+        result.columns[1] = {
+            (-c1.x * t5 + c1.z * t2 - c1.w * t1) * inverse,
+            ( c0.x * t5 - c0.z * t2 + c0.w * t1) * inverse,
+            (-c3.x * s5 + c3.z * s2 - c3.w * s1) * inverse,
+            ( c2.x * s5 - c2.z * s2 + c2.w * s1) * inverse
+        };
+        result.columns[2] = {
+            ( c1.x * t4 - c1.y * t2 + c1.w * t0) * inverse,
+            (-c0.x * t4 + c0.y * t2 - c0.w * t0) * inverse,
+            ( c3.x * s4 - c3.y * s2 + c3.w * s0) * inverse,
+            (-c2.x * s4 + c2.y * s2 - c2.w * s0) * inverse
+        };
+        result.columns[3] = {
+            (-c1.x * t3 + c1.y * t1 - c1.z * t0) * inverse,
+            ( c0.x * t3 - c0.y * t1 + c0.z * t0) * inverse,
+            (-c3.x * s3 + c3.y * s1 - c3.z * s0) * inverse,
+            ( c2.x * s3 - c2.y * s1 + c2.z * s0) * inverse
+        };
+        return result;
+    }
+
+}
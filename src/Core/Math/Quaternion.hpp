@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Vector.hpp"
+
+namespace Core::Math {
+
+    // Rotation quaternion, w is the scalar part. Products compose right to left like matrices.
+    struct Quat
+    {
+        f32 x = 0.0f;
+        f32 y = 0.0f;
+        f32 z = 0.0f;
+        f32 w = 1.0f;
+
+        constexpr Quat() noexcept = default;
+        constexpr Quat(f32 x, f32 y, f32 z, f32 w) noexcept : x(x), y(y), z(z), w(w) {}
+
+        [[nodiscard]] static inline Quat FromAxisAngle(Vec3 axis, f32 radians) noexcept
+        {
+            const Vec3 unit = Normalize(axis);
+            const f32 s = std::sin(radians * 0.5f);
+            return { unit.x * s, unit.y * s, unit.z * s, std::cos(radians * 0.5f) };
+        }
+
+        constexpr Quat operator*(const Quat& other) const noexcept
+        {
+            return {
+                w * other.x + x * other.w + y * other.z - z * other.y,
+                w * other.y - x * other.z + y * other.w + z * other.x,
+                w * other.z + x * other.y - y * other.x + z * other.w,
+                w * other.w - x * other.x - y * other.y - z * other.z
+            };
+        }
+
+        constexpr bool operator==(const Quat&) const noexcept = default;
+
+        [[nodiscard]] constexpr Quat Conjugate() const noexcept { return { -x, -y, -z, w }; }
+
+        [[nodiscard]] constexpr Vec3 Rotate(Vec3 v) const noexcept
+        {
+            // v + 2w(q x v) + 2q x (q x v), without building a matrix
+            const Vec3 q { x, y, z };
+            const Vec3 t = Cross(q, v) * 2.0f;
+            return v + t * w + Cross(q, t);
+        }
+    };
+
+    [[nodiscard]] constexpr f32 Dot(const Quat& a, const Quat& b) noexcept
+    {
+        return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+    }
+
+    [[nodiscard]] inline Quat Normalize(const Quat& q) noexcept
+    {
+        const f32 length = std::sqrt(Dot(q, q));
+        if (length <= 0.0f) return Quat {};
+
+        const f32 inverse = 1.0f / length;
+        return { q.x * inverse, q.y * inverse, q.z * inverse, q.w * inverse };
+    }
+
+    // Shortest-path spherical interpolation, falls back to normalized lerp when nearly parallel
+    [[nodiscard]] inline Quat Slerp(const Quat& a, Quat b, f32 t) noexcept
+    {
+        f32 cosine = Dot(a, b);
+        if (cosine < 0.0f) {
+            b = { -b.x, -b.y, -b.z, -b.w };
+            cosine = -cosine;
+        }
+
+        f32 wa = 1.0f - t;
+        f32 wb = t;
+
+        if (cosine < 0.9995f) {
+            const f32 angle = std::acos(cosine);
+            const f32 inverseSine = 1.0f / std::sin(angle);
+            wa = std::sin((1.0f - t) * angle) * inverseSine;
+            wb = std::sin(t * angle) * inverseSine;
+        }
+
+        return Normalize(Quat { a.x * wa + b.x * wb, a.y * wa + b.y * wb, a.z * wa + b.z * wb, a.w * wa + b.w * wb });
+    }
+
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+// The math headers are included by kernel translation units built without
+// the precompiled header, so they include what they use themselves.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "Types.hpp"
+
+namespace Core::Math {
+
+    struct Vec2
+    {
+        f32 x = 0.0f;
+        f32 y = 0.0f;
+
+        constexpr Vec2() noexcept = default;
+        constexpr Vec2(f32 x, f32 y) noexcept : x(x), y(y) {}
+        constexpr explicit Vec2(f32 value) noexcept : x(value), y(value) {}
+
+        constexpr Vec2 operator-() const noexcept { return { -x, -y }; }
+        constexpr Vec2 operator+(Vec2 other) const noexcept { return { x + other.x, y + other.y }; }
+        constexpr Vec2 operator-(Vec2 other) const noexcept { return { x - other.x, y - other.y }; }
+        constexpr Vec2 operator*(Vec2 other) const noexcept { return { x * other.x, y * other.y }; }
+        constexpr Vec2 operator*(f32 scalar) const noexcept { return { x * scalar, y * scalar }; }
+        constexpr Vec2 operator/(f32 scalar) const noexcept { return { x / scalar, y / scalar }; }
+
+        constexpr Vec2& operator+=(Vec2 other) noexcept { return *this = *this + other; }
+        constexpr Vec2& operator-=(Vec2 other) noexcept { return *this = *this - other; }
+        constexpr Vec2& operator*=(f32 scalar) noexcept { return *this = *this * scalar; }
+
+        constexpr bool operator==(const Vec2&) const noexcept = default;
+    };
+
+    struct Vec3
+    {
+        f32 x = 0.0f;
+        f32 y = 0.0f;
+        f32 z = 0.0f;
+
+        constexpr Vec3() noexcept = default;
+        constexpr Vec3(f32 x, f32 y, f32 z) noexcept : x(x), y(y), z(z) {}
+        constexpr explicit Vec3(f32 value) noexcept : x(value), y(value), z(value) {}
+
+        constexpr Vec3 operator-() const noexcept { return { -x, -y, -z }; }
+        constexpr Vec3 operator+(Vec3 other) const noexcept { return { x + other.x, y + other.y, z + other.z }; }
+        constexpr Vec3 operator-(Vec3 other) const noexcept { return { x - other.x, y - other.y, z - other.z }; }
+        constexpr Vec3 operator*(Vec3 other) const noexcept { return { x * other.x, y * other.y, z * other.z }; }
+        constexpr Vec3 operator*(f32 scalar) const noexcept { return { x * scalar, y * scalar, z * scalar }; }
+        constexpr Vec3 operator/(f32 scalar) const noexcept { return { x / scalar, y / scalar, z / scalar }; }
+
+        constexpr Vec3& operator+=(Vec3 other) noexcept { return *this = *this + other; }
+        constexpr Vec3& operator-=(Vec3 other) noexcept { return *this = *this - other; }
+        constexpr Vec3& operator*=(f32 scalar) noexcept { return *this = *this * scalar; }
+
+        constexpr bool operator==(const Vec3&) const noexcept = default;
+    };
+
+    struct Vec4
+    {
+        f32 x = 0.0f;
+        f32 y = 0.0f;
+        f32 z = 0.0f;
+        f32 w = 0.0f;
+
+        constexpr Vec4() noexcept = default;
+        constexpr Vec4(f32 x, f32 y, f32 z, f32 w) noexcept : x(x), y(y), z(z), w(w) {}
+        constexpr Vec4(Vec3 xyz, f32 w) noexcept : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+        constexpr explicit Vec4(f32 value) noexcept : x(value), y(value), z(value), w(value) {}
+
+        [[nodiscard]] constexpr Vec3 XYZ() const noexcept { return { x, y, z }; }
+
+        constexpr Vec4 operator-() const noexcept { return { -x, -y, -z, -w }; }
+        constexpr Vec4 operator+(Vec4 other) const noexcept { return { x + other.x, y + other.y, z + other.z, w + other.w }; }
+        constexpr Vec4 operator-(Vec4 other) const noexcept { return { x - other.x, y - other.y, z - other.z, w - other.w }; }
+        constexpr Vec4 operator*(Vec4 other) const noexcept { return { x * other.x, y * other.y, z * other.z, w * other.w }; }
+        constexpr Vec4 operator*(f32 scalar) const noexcept { return { x * scalar, y * scalar, z * scalar, w * scalar }; }
+        constexpr Vec4 operator/(f32 scalar) const noexcept { return { x / scalar, y / scalar, z / scalar, w / scalar }; }
+
+        constexpr Vec4& operator+=(Vec4 other) noexcept { return *this = *this + other; }
+        constexpr Vec4& operator-=(Vec4 other) noexcept { return *this = *this - other; }
+        constexpr Vec4& operator*=(f32 scalar) noexcept { return *this = *this * scalar; }
+
+        constexpr bool operator==(const Vec4&) const noexcept = default;
+    };
+
+    constexpr Vec2 operator*(f32 scalar, Vec2 v) noexcept { return v * scalar; }
+    constexpr Vec3 operator*(f32 scalar, Vec3 v) noexcept { return v * scalar; }
+    constexpr Vec4 operator*(f32 scalar, Vec4 v) noexcept { return v * scalar; }
+
+    [[nodiscard]] constexpr f32 Dot(Vec2 a, Vec2 b) noexcept { return a.x * b.x + a.y * b.y; }
+    [[nodiscard]] constexpr f32 Dot(Vec3 a, Vec3 b) noexcept { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    [[nodiscard]] constexpr f32 Dot(Vec4 a, Vec4 b) noexcept { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+    [[nodiscard]] constexpr Vec3 Cross(Vec3 a, Vec3 b) noexcept
+    {
+        return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+    }
+
+    template <typename TVec>
+    [[nodiscard]] constexpr f32 LengthSquared(TVec v) noexcept { return Dot(v, v); }
+
+    template <typename TVec>
+    [[nodiscard]] inline f32 Length(TVec v) noexcept { return std::sqrt(Dot(v, v)); }
+
+    // Zero-length vectors stay zero instead of turning into NaNs
+    template <typename TVec>
+    [[nodiscard]] inline TVec Normalize(TVec v) noexcept
+    {
+        const f32 length = Length(v);
+        return length > 0.0f ? v / length : TVec {};
+    }
+
+    template <typename TVec>
+    [[nodiscard]] constexpr TVec Lerp(TVec a, TVec b, f32 t) noexcept { return a + (b - a) * t; }
+
+    [[nodiscard]] constexpr Vec3 Min(Vec3 a, Vec3 b) noexcept
+    {
+        return { a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y, a.z < b.z ? a.z : b.z };
+    }
+
+    [[nodiscard]] constexpr Vec3 Max(Vec3 a, Vec3 b) noexcept
+    {
+        return { a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y, a.z > b.z ? a.z : b.z };
+    }
+
+    struct AABB
+    {
+        Vec3 min;
+        Vec3 max;
+
+        [[nodiscard]] constexpr bool Overlaps(const AABB& other) const noexcept
+        {
+            return min.x <= other.max.x && max.x >= other.min.x
+                && min.y <= other.max.y && max.y >= other.min.y
+                && min.z <= other.max.z && max.z >= other.min.z;
+        }
+
+        [[nodiscard]] constexpr bool Contains(Vec3 point) const noexcept
+        {
+            return point.x >= min.x && point.x <= max.x
+                && point.y >= min.y && point.y <= max.y
+                && point.z >= min.z && point.z <= max.z;
+        }
+
+        [[nodiscard]] constexpr Vec3 GetCenter() const noexcept { return (min + max) * 0.5f; }
+        [[nodiscard]] constexpr Vec3 GetExtents() const noexcept { return (max - min) * 0.5f; }
+    };
+
+}
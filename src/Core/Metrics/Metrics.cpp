@@ -0,0 +1,209 @@
+#include "Metrics.hpp"
+
+#if defined(__unix__)
+    #include <fcntl.h>
+    #include <signal.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Core::Metrics {
+
+#if defined(__unix__)
+    namespace {
+
+        // The pid of another running process publishing to the segment, if any
+        std::optional<u32> FindLiveOwner(i32 fd)
+        {
+            struct stat info {};
+            if (fstat(fd, &info) != 0 || static_cast<usize>(info.st_size) < sizeof(SharedHeader)) return std::nullopt;
+
+            void* mapping = mmap(nullptr, sizeof(SharedHeader), PROT_READ, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) return std::nullopt;
+
+            const SharedHeader& header = *static_cast<const SharedHeader*>(mapping);
+            const u32 magic = header.magic;
+            const u32 pid = header.pid;
+            munmap(mapping, sizeof(SharedHeader));
+
+            if (magic != LayoutMagic || pid == 0 || pid == static_cast<u32>(getpid())) return std::nullopt;
+
+            // EPERM still means the process exists
+            if (kill(static_cast<pid_t>(pid), 0) != 0 && errno == ESRCH) return std::nullopt;
+
+            return pid;
+        }
+
+    }
+#endif
+
+    bool Registry::Init(std::string_view segmentName)
+    {
+#if defined(__unix__)
+        if (s_Shared) return true;
+
+        s_SegmentName = segmentName;
+
+        i32 fd = shm_open(s_SegmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd < 0 && errno == EEXIST) {
+            fd = shm_open(s_SegmentName.c_str(), O_RDWR, 0);
+
+            // Left behind by a run that crashed is fine, a live one is not ours to reset
+            if (fd >= 0) {
+                if (std::optional<u32> owner = FindLiveOwner(fd)) {
+                    LOG_WARN("Metrics: segment \"{}\" is in use by pid {}, not publishing", s_SegmentName, *owner);
+                    close(fd);
+                    return false;
+                }
+                LOG_DEBUG("Metrics: reusing stale segment \"{}\"", s_SegmentName);
+            }
+        }
+
+        if (fd < 0) {
+            LOG_WARN("Metrics: shm_open(\"{}\") failed: {}", s_SegmentName, std::strerror(errno));
+            return false;
+        }
+
+        if (ftruncate(fd, sizeof(SharedLayout)) != 0) {
+            LOG_WARN("Metrics: ftruncate failed: {}", std::strerror(errno));
+            close(fd);
+            return false;
+        }
+
+        void* mapping = mmap(nullptr, sizeof(SharedLayout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if (mapping == MAP_FAILED) {
+            LOG_WARN("Metrics: mmap failed: {}", std::strerror(errno));
+            return false;
+        }
+
+        s_Shared = static_cast<SharedLayout*>(mapping);
+        std::memset(static_cast<void*>(s_Shared), 0, sizeof(SharedLayout));
+
+        SharedHeader& header = s_Shared->header;
+        header.magic = LayoutMagic;
+        header.version = LayoutVersion;
+        header.headerSize = sizeof(SharedHeader);
+        header.metricSize = sizeof(SharedMetric);
+        header.pid = static_cast<u32>(getpid());
+        header.sequence.store(0, std::memory_order_release);
+
+        LOG_INFO("Metrics: publishing to shared memory segment \"{}\"", s_SegmentName);
+        return true;
+#else
+        (void)segmentName;
+        LOG_WARN("Metrics: shared memory export is not supported on this platform");
+        return false;
+#endif
+    }
+
+    void Registry::Shutdown()
+    {
+#if defined(__unix__)
+        if (!s_Shared) return;
+
+        munmap(s_Shared, sizeof(SharedLayout));
+        shm_unlink(s_SegmentName.c_str());
+        s_Shared = nullptr;
+#endif
+    }
+
+    Counter& Registry::GetCounter(std::string_view name)
+    {
+        return FindOrAdd(name, MetricType::Counter).counter;
+    }
+
+    Gauge& Registry::GetGauge(std::string_view name)
+    {
+        return FindOrAdd(name, MetricType::Gauge).gauge;
+    }
+
+    Histogram& Registry::GetHistogram(std::string_view name)
+    {
+        return FindOrAdd(name, MetricType::Histogram).histogram;
+    }
+
+    void Registry::Publish()
+    {
+        if (!s_Shared) return;
+
+        SharedHeader& header = s_Shared->header;
+        const u32 count = s_SlotCount.load(std::memory_order_acquire);
+
+        const u64 sequence = header.sequence.load(std::memory_order_relaxed);
+        header.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (u32 i = 0; i < count; ++i) {
+            const Slot& slot = s_Slots[i];
+            SharedMetric& metric = s_Shared->metrics[i];
+
+            std::memcpy(metric.name, slot.name, MaxNameLength);
+            metric.type = slot.type;
+
+            switch (slot.type) {
+                case MetricType::Counter: {
+                    metric.value = slot.counter.Get();
+                } break;
+                case MetricType::Gauge: {
+                    metric.value = std::bit_cast<u64>(slot.gauge.Get());
+                } break;
+                case MetricType::Histogram: {
+                    metric.value = slot.histogram.GetCount();
+                    metric.sum = slot.histogram.GetSum();
+                    for (usize bucket = 0; bucket < HistogramBuckets; ++bucket) {
+                        metric.buckets[bucket] = slot.histogram.GetBucket(bucket);
+                    }
+                } break;
+            }
+        }
+
+        header.metricCount = count;
+        header.publishCount++;
+        header.publishTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()
+        ).count();
+
+        header.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    Registry::Slot& Registry::FindOrAdd(std::string_view name, MetricType type)
+    {
+        const usize length = std::min(name.size(), MaxNameLength - 1);
+        name = name.substr(0, length);
+
+        auto matches = [&](const Slot& slot) {
+            return slot.type == type && std::string_view(slot.name) == name;
+        };
+
+        const u32 count = s_SlotCount.load(std::memory_order_acquire);
+        for (u32 i = 0; i < count; ++i) {
+            if (matches(s_Slots[i])) return s_Slots[i];
+        }
+
+        std::lock_guard<std::mutex> lock(s_RegisterMutex);
+
+        // Another thread may have registered it while we waited for the lock
+        const u32 lockedCount = s_SlotCount.load(std::memory_order_relaxed);
+        for (u32 i = count; i < lockedCount; ++i) {
+            if (matches(s_Slots[i])) return s_Slots[i];
+        }
+
+        if (lockedCount == MaxMetrics) {
+            LOG_WARN("Metrics: registry full, \"{}\" will not be published", name);
+            return s_Overflow;
+        }
+
+        Slot& slot = s_Slots[lockedCount];
+        std::memcpy(slot.name, name.data(), length);
+        slot.name[length] = '\0';
+        slot.type = type;
+
+        s_SlotCount.store(lockedCount + 1, std::memory_order_release);
+
+        return slot;
+    }
+
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "MetricsLayout.hpp"
+
+namespace Core::Metrics {
+
+    class Counter
+    {
+    public:
+        inline void Increment(u64 amount = 1) noexcept
+        {
+            m_Value.fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] inline u64 Get() const noexcept
+        {
+            return m_Value.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<u64> m_Value = 0;
+    };
+
+    class Gauge
+    {
+    public:
+        inline void Set(f64 value) noexcept
+        {
+            m_Value.store(value, std::memory_order_relaxed);
+        }
+
+        inline void Add(f64 amount) noexcept
+        {
+            m_Value.fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] inline f64 Get() const noexcept
+        {
+            return m_Value.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<f64> m_Value = 0.0;
+    };
+
+    class Histogram
+    {
+    public:
+        inline void Record(u64 value) noexcept
+        {
+            const usize bucket = std::min<usize>(std::bit_width(value), HistogramBuckets - 1);
+
+            m_Buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+            m_Count.fetch_add(1, std::memory_order_relaxed);
+            m_Sum.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] inline u64 GetCount() const noexcept { return m_Count.load(std::memory_order_relaxed); }
+        [[nodiscard]] inline u64 GetSum() const noexcept { return m_Sum.load(std::memory_order_relaxed); }
+
+        [[nodiscard]] inline u64 GetBucket(usize index) const noexcept
+        {
+            return m_Buckets[index].load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<std::atomic<u64>, HistogramBuckets> m_Buckets {};
+        std::atomic<u64> m_Count = 0;
+        std::atomic<u64> m_Sum = 0;
+    };
+
+    struct MetricSlot
+    {
+        char name[MaxNameLength] {};
+        MetricType type = MetricType::Counter;
+
+        Counter counter;
+        Gauge gauge;
+        Histogram histogram;
+    };
+
+    // Metrics are registered once by name and live for the whole process, so
+    // references can be cached. Updates are relaxed atomics; Publish copies
+    // everything into the shared-memory segment under a seqlock.
+    class Registry
+    {
+    public:
+        static bool Init(std::string_view segmentName = DefaultSegmentName);
+        static void Shutdown();
+
+        static Counter& GetCounter(std::string_view name);
+        static Gauge& GetGauge(std::string_view name);
+        static Histogram& GetHistogram(std::string_view name);
+
+        static void Publish();
+
+    private:
+        using Slot = MetricSlot;
+
+        static Slot& FindOrAdd(std::string_view name, MetricType type);
+
+    private:
+        inline static std::array<Slot, MaxMetrics> s_Slots;
+        inline static std::atomic<u32> s_SlotCount = 0;
+        inline static std::mutex s_RegisterMutex;
+
+        inline static Slot s_Overflow;
+
+        inline static SharedLayout* s_Shared = nullptr;
+        inline static std::string s_SegmentName;
+    };
+
+}
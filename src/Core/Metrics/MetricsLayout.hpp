@@ -0,0 +1,63 @@
+#pragma once
+
+// Shared-memory layout published by Metrics::Registry and read by the
+// MetricsReader tool. Bump LayoutVersion on any change to these structs.
+
+namespace Core::Metrics {
+
+    inline constexpr u32 LayoutMagic = 0x5254454D; // "METR"
+    inline constexpr u32 LayoutVersion = 1;
+
+    inline constexpr usize MaxMetrics = 128;
+    inline constexpr usize MaxNameLength = 48;
+    inline constexpr usize HistogramBuckets = 32;
+
+    inline constexpr const char* DefaultSegmentName = "/Application.metrics";
+
+    enum class MetricType : u32
+    {
+        Counter,
+        Gauge,
+        Histogram
+    };
+
+    struct SharedMetric
+    {
+        char name[MaxNameLength];
+        MetricType type;
+        u32 reserved;
+
+        // Counter: count, Gauge: bit pattern of an f64, Histogram: sample count
+        u64 value;
+        u64 sum;
+
+        // Bucket i holds samples whose bit width is i, i.e. values in [2^(i-1), 2^i)
+        u64 buckets[HistogramBuckets];
+    };
+
+    struct SharedHeader
+    {
+        u32 magic;
+        u32 version;
+        u32 headerSize;
+        u32 metricSize;
+
+        // Seqlock: odd while the writer is publishing
+        std::atomic<u64> sequence;
+
+        u64 publishCount;
+        i64 publishTimeNs;
+        u32 pid;
+        u32 metricCount;
+    };
+
+    struct SharedLayout
+    {
+        SharedHeader header;
+        SharedMetric metrics[MaxMetrics];
+    };
+
+    static_assert(std::atomic<u64>::is_always_lock_free, "Seqlock requires lock-free 64-bit atomics");
+    static_assert(std::is_trivially_copyable_v<SharedMetric>);
+
+}
@@ -0,0 +1,225 @@
+#include "HitchWatchdog.hpp"
+
+#include "StackWalk.hpp"
+
+#include "Core/Threading.hpp"
+
+#if defined(__linux__)
+    #include <execinfo.h>
+    #include <pthread.h>
+    #include <signal.h>
+    #include <unistd.h>
+#endif
+
+namespace Core {
+
+#if defined(__linux__)
+    namespace {
+
+        // Idle -> Requested by the watchdog, Requested -> Writing -> Ready by the
+        // handler, back to Idle by the watchdog. A late signal finds the state
+        // Idle and leaves the buffer alone.
+        enum class CaptureState : u8
+        {
+            Idle,
+            Requested,
+            Writing,
+            Ready
+        };
+
+        constexpr i32 CaptureSignal = SIGUSR2;
+        constexpr auto CaptureTimeout = std::chrono::milliseconds(100);
+
+        // The handler and the trampoline it returns through come first
+        constexpr usize SkippedFrames = 2;
+
+        std::atomic<CaptureState> s_CaptureState = CaptureState::Idle;
+        std::array<void*, HitchWatchdog::MaxDepth + SkippedFrames> s_CaptureFrames;
+        usize s_CaptureDepth = 0;
+
+        pthread_t s_MainThread {};
+        bool s_HandlerInstalled = false;
+        std::filesystem::path s_HitchPath;
+
+        // Unwinds with the CFI unwinder rather than frame pointers: a stall usually
+        // sits in a libc call, and a frame-pointer walk loses that call's caller
+        void OnCaptureSignal(i32, siginfo_t*, void*)
+        {
+            CaptureState expected = CaptureState::Requested;
+            if (!s_CaptureState.compare_exchange_strong(expected, CaptureState::Writing)) return;
+
+            s_CaptureDepth = static_cast<usize>(backtrace(s_CaptureFrames.data(), static_cast<i32>(s_CaptureFrames.size())));
+            s_CaptureState.store(CaptureState::Ready, std::memory_order_release);
+        }
+
+        // Empty when the main thread did not run the handler in time, e.g. while
+        // blocked in an uninterruptible system call
+        std::vector<uintptr_t> CaptureMainStack()
+        {
+            s_CaptureState.store(CaptureState::Requested);
+
+            if (pthread_kill(s_MainThread, CaptureSignal) != 0) {
+                s_CaptureState.store(CaptureState::Idle);
+                return {};
+            }
+
+            const auto deadline = std::chrono::steady_clock::now() + CaptureTimeout;
+
+            for (;;) {
+                CaptureState state = s_CaptureState.load(std::memory_order_acquire);
+
+                if (state == CaptureState::Ready) {
+                    std::vector<uintptr_t> frames;
+                    for (usize i = SkippedFrames; i < s_CaptureDepth; ++i) {
+                        frames.push_back(reinterpret_cast<uintptr_t>(s_CaptureFrames[i]));
+                    }
+                    s_CaptureState.store(CaptureState::Idle);
+                    return frames;
+                }
+
+                // Once the handler is writing, wait for it to finish
+                if (state == CaptureState::Requested && std::chrono::steady_clock::now() > deadline
+                    && s_CaptureState.compare_exchange_strong(state, CaptureState::Idle)) {
+                    return {};
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+    }
+#endif
+
+    void HitchWatchdog::Start(const Config& config)
+    {
+        if (!config.enabled || s_Thread.joinable()) return;
+
+#if defined(__linux__)
+        // Also catches NaN; a zero poll interval would spin and flag every frame
+        if (!(config.deadline > 0.0f) || !std::isfinite(config.deadline)) {
+            LOG_WARN("Hitch watchdog disabled: deadline must be a positive number of seconds, got {}", config.deadline);
+            return;
+        }
+
+        s_Config = config;
+        s_Config.minReportInterval = std::max(config.minReportInterval, 0.0f);
+        s_MainThread = pthread_self();
+        s_HitchPath = config.outputDirectory / std::format("Hitch-{}.log", getpid());
+
+        if (!s_HandlerInstalled) {
+            // backtrace() loads libgcc lazily; do it now rather than inside the handler
+            void* warmup[1];
+            backtrace(warmup, 1);
+
+            struct sigaction action {};
+            action.sa_sigaction = &OnCaptureSignal;
+            action.sa_flags = SA_SIGINFO | SA_RESTART;
+            sigemptyset(&action.sa_mask);
+
+            if (sigaction(CaptureSignal, &action, nullptr) != 0) {
+                LOG_WARN("Hitch watchdog disabled: cannot install the stack capture handler: {}", std::strerror(errno));
+                return;
+            }
+            s_HandlerInstalled = true;
+        }
+
+        s_Thread = std::jthread(&HitchWatchdog::Run);
+
+        LOG_DEBUG("Hitch watchdog started, deadline {:.0f} ms, reports go to {}", config.deadline * 1000.0f, s_HitchPath.string());
+#else
+        LOG_DEBUG("Hitch watchdog is only available on Linux");
+#endif
+    }
+
+    void HitchWatchdog::Stop()
+    {
+        if (!s_Thread.joinable()) return;
+
+        s_Thread.request_stop();
+        s_Thread.join();
+        s_Thread = {};
+    }
+
+    void HitchWatchdog::Run(std::stop_token stop)
+    {
+        Threading::Topology::Apply(Threading::ThreadRole::Background, "Watchdog");
+
+        const i64 deadlineNs = static_cast<i64>(static_cast<f64>(s_Config.deadline) * 1e9);
+        const i64 minReportIntervalNs = static_cast<i64>(static_cast<f64>(s_Config.minReportInterval) * 1e9);
+
+        // Checking four times per deadline catches a hitch at most a quarter deadline late
+        const auto pollInterval = std::chrono::duration<f32>(s_Config.deadline / 4.0f);
+
+        u64 reportedFrame = 0;
+        std::optional<i64> lastReportNs;
+        u64 suppressed = 0;
+
+        std::unique_lock lock(s_Mutex);
+
+        while (!stop.stop_requested()) {
+            s_Wake.wait_for(lock, stop, pollInterval, [] { return false; });
+            if (stop.stop_requested()) break;
+
+            // Frame 0 means the loop has not started yet
+            const u64 frame = s_HeartbeatFrame.load(std::memory_order_acquire);
+            if (frame == 0 || frame == reportedFrame) continue;
+
+            const i64 now = GetTimeNs();
+            const i64 elapsedNs = now - s_HeartbeatNs.load(std::memory_order_relaxed);
+            if (elapsedNs < deadlineNs) continue;
+
+            // One report per stalled frame, and none at all while the rate limit holds
+            reportedFrame = frame;
+
+            if (lastReportNs && now - *lastReportNs < minReportIntervalNs) {
+                ++suppressed;
+                continue;
+            }
+            lastReportNs = now;
+
+            lock.unlock();
+            Report(frame, static_cast<f64>(elapsedNs) / 1e6, suppressed);
+            lock.lock();
+
+            suppressed = 0;
+        }
+    }
+
+    void HitchWatchdog::Report(u64 frame, f64 elapsedMs, u64 suppressed)
+    {
+#if defined(__linux__)
+        const std::vector<uintptr_t> frames = CaptureMainStack();
+
+        std::string stack;
+        for (usize i = 0; i < frames.size(); ++i) {
+            // Return addresses point past the call, look up the call itself
+            stack += std::format("  #{:<2} {}\n", i, SymbolizeAddress(i == 0 ? frames[i] : frames[i] - 1));
+        }
+        if (frames.empty()) {
+            stack = "  (the main thread did not answer the stack request)\n";
+        }
+
+        const std::string header = std::format("frame {} running for {:.1f} ms (deadline {:.1f} ms){}",
+            frame, elapsedMs, s_Config.deadline * 1000.0f,
+            suppressed > 0 ? std::format(", {} hitch(es) since the last report", suppressed) : std::string());
+
+        LOG_WARN("Hitch: {}, main thread stack:\n{}", header, std::string_view(stack).substr(0, stack.size() - 1));
+
+        std::error_code error;
+        std::filesystem::create_directories(s_Config.outputDirectory, error);
+
+        std::ofstream file(s_HitchPath, std::ios::app);
+        if (!file) {
+            LOG_WARN("Hitch: cannot open {}", s_HitchPath.string());
+            return;
+        }
+
+        file << "==== " << header << " ====\n" << stack << '\n';
+#else
+        (void)frame;
+        (void)elapsedMs;
+        (void)suppressed;
+#endif
+    }
+
+}
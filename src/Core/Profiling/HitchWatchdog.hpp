@@ -0,0 +1,58 @@
+#pragma once
+
+namespace Core {
+
+    struct HitchWatchdogConfig
+    {
+        bool enabled = true;
+        f32 deadline = 0.25f;               // Seconds a frame may take before it counts as a hitch
+        f32 minReportInterval = 10.0f;      // Seconds between reports, hitches in between are only counted
+        std::filesystem::path outputDirectory = "logs";
+    };
+
+    // Watches the heartbeat the frame loop writes every iteration. When a frame
+    // runs past the deadline, the watchdog thread signals the main thread,
+    // whose handler unwinds its own stack in the middle of the stall. The
+    // watchdog then symbolizes the stack and reports frame, elapsed time and
+    // stack to the log and to logs/Hitch-<pid>.log. Each stalled frame is
+    // reported once, and reports are rate limited.
+    class HitchWatchdog
+    {
+        friend class Application;
+    public:
+        using Config = HitchWatchdogConfig;
+
+        static constexpr usize MaxDepth = 64;
+
+    public:
+        inline static void Heartbeat(u64 frame) noexcept
+        {
+            s_HeartbeatNs.store(GetTimeNs(), std::memory_order_relaxed);
+            s_HeartbeatFrame.store(frame, std::memory_order_release);
+        }
+
+    protected:
+        // Call on the thread that runs the frame loop, it is the one that gets sampled
+        static void Start(const Config& config);
+        static void Stop();
+
+    private:
+        static void Run(std::stop_token stop);
+        static void Report(u64 frame, f64 elapsedMs, u64 suppressed);
+
+        [[nodiscard]] inline static i64 GetTimeNs() noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+    private:
+        inline static Config s_Config;
+        inline static std::jthread s_Thread;
+        inline static std::mutex s_Mutex;
+        inline static std::condition_variable_any s_Wake;
+
+        inline static std::atomic<u64> s_HeartbeatFrame = 0;
+        inline static std::atomic<i64> s_HeartbeatNs = 0;
+    };
+
+}
@@ -0,0 +1,280 @@
+#include "PerfCounters.hpp"
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace Core {
+
+    namespace {
+
+        constexpr std::array<std::string_view, FramePhaseCount> PhaseNames {
+            "poll",
+            "input",
+            "io",
+            "events",
+            "timers",
+            "tasks",
+            "render",
+            "deferred",
+            "metrics"
+        };
+
+#if defined(__linux__)
+        struct EventSpec
+        {
+            u32 type;
+            u64 config;
+            std::string_view name;
+        };
+
+        constexpr std::array<EventSpec, PerfEventCount> EventSpecs { {
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "cycles" },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions" },
+            { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), "L1D misses" },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "LLC misses" },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "branch misses" }
+        } };
+
+        // Layout of a PERF_FORMAT_GROUP read with both times enabled
+        struct GroupReadFormat
+        {
+            u64 count;
+            u64 timeEnabled;
+            u64 timeRunning;
+            u64 values[PerfEventCount];
+        };
+
+        i32 OpenEvent(const EventSpec& spec, i32 groupFd)
+        {
+            perf_event_attr attr {};
+            attr.size = sizeof(attr);
+            attr.type = spec.type;
+            attr.config = spec.config;
+            attr.disabled = groupFd < 0 ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            return static_cast<i32>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+        }
+
+        std::string GetParanoidLevel()
+        {
+            std::ifstream file("/proc/sys/kernel/perf_event_paranoid");
+            std::string level;
+            return file >> level ? level : std::string("unknown");
+        }
+#endif
+
+    }
+
+    std::expected<PerfCounterGroup, std::string> PerfCounterGroup::Open()
+    {
+#if defined(__linux__)
+        PerfCounterGroup group;
+
+        for (usize i = 0; i < PerfEventCount; ++i) {
+            const i32 fd = OpenEvent(EventSpecs[i], group.m_Leader);
+
+            if (fd < 0) {
+                const i32 error = errno;
+
+                if (i == 0) {
+                    if (error == EACCES || error == EPERM) {
+                        return std::unexpected(std::format("access denied, perf_event_paranoid is {} (needs 2 or lower, or CAP_PERFMON)", GetParanoidLevel()));
+                    }
+                    return std::unexpected(std::format("cannot count {}: {}", EventSpecs[i].name, std::strerror(error)));
+                }
+
+                LOG_DEBUG("Perf counters: {} not available: {}", EventSpecs[i].name, std::strerror(error));
+                continue;
+            }
+
+            if (i == 0) group.m_Leader = fd;
+
+            group.m_Fds[i] = fd;
+            group.m_Slots[i] = static_cast<i8>(group.m_Count++);
+        }
+
+        ioctl(group.m_Leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        if (ioctl(group.m_Leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0) {
+            return std::unexpected(std::string("cannot enable the counter group: ") + std::strerror(errno));
+        }
+
+        return group;
+#else
+        return std::unexpected("hardware counters are only available on Linux");
+#endif
+    }
+
+    PerfCounterGroup::~PerfCounterGroup()
+    {
+        Close();
+    }
+
+    PerfCounterGroup::PerfCounterGroup(PerfCounterGroup&& other) noexcept
+        : m_Leader(std::exchange(other.m_Leader, -1)),
+          m_Fds(std::exchange(other.m_Fds, { -1, -1, -1, -1, -1 })),
+          m_Slots(std::exchange(other.m_Slots, { -1, -1, -1, -1, -1 })),
+          m_Count(std::exchange(other.m_Count, 0))
+    {
+    }
+
+    PerfCounterGroup& PerfCounterGroup::operator=(PerfCounterGroup&& other) noexcept
+    {
+        if (this != &other) {
+            Close();
+
+            m_Leader = std::exchange(other.m_Leader, -1);
+            m_Fds = std::exchange(other.m_Fds, { -1, -1, -1, -1, -1 });
+            m_Slots = std::exchange(other.m_Slots, { -1, -1, -1, -1, -1 });
+            m_Count = std::exchange(other.m_Count, 0);
+        }
+
+        return *this;
+    }
+
+    void PerfCounterGroup::Close() noexcept
+    {
+#if defined(__linux__)
+        // Members first, the leader last
+        for (usize i = PerfEventCount; i-- > 0;) {
+            if (m_Fds[i] >= 0) ::close(m_Fds[i]);
+        }
+#endif
+        m_Fds.fill(-1);
+        m_Slots.fill(-1);
+        m_Leader = -1;
+        m_Count = 0;
+    }
+
+    bool PerfCounterGroup::Read(PerfSample& sample) const noexcept
+    {
+#if defined(__linux__)
+        if (m_Leader < 0) return false;
+
+        GroupReadFormat data;
+        const ssize_t size = ::read(m_Leader, &data, sizeof(data));
+        if (size < static_cast<ssize_t>(3 * sizeof(u64)) || data.count != m_Count) return false;
+
+        sample.timeEnabled = data.timeEnabled;
+        sample.timeRunning = data.timeRunning;
+
+        for (usize i = 0; i < PerfEventCount; ++i) {
+            sample.values[i] = m_Slots[i] >= 0 ? data.values[m_Slots[i]] : 0;
+        }
+
+        return true;
+#else
+        (void)sample;
+        return false;
+#endif
+    }
+
+    std::string_view PerfCounters::GetPhaseName(FramePhase phase) noexcept
+    {
+        return PhaseNames[static_cast<usize>(phase)];
+    }
+
+    void PerfCounters::Init(const Config& config)
+    {
+        s_Config = config;
+        if (!config.enabled) return;
+
+        auto group = PerfCounterGroup::Open();
+        if (!group) {
+            LOG_WARN("Perf counters disabled: {}", group.error());
+            return;
+        }
+
+        s_Group = std::move(*group);
+        s_Totals = {};
+        s_Frames = 0;
+        s_LastReport = std::chrono::steady_clock::now();
+        s_Active = s_Group.Read(s_Last);
+
+        if (s_Active) {
+            LOG_INFO("Perf counters enabled, reporting every {:.1f}s", config.reportInterval);
+        } else {
+            LOG_WARN("Perf counters disabled: the counter group cannot be read");
+            s_Group = {};
+        }
+    }
+
+    void PerfCounters::Shutdown()
+    {
+        s_Active = false;
+        s_Group = {};
+    }
+
+    void PerfCounters::Accumulate(FramePhase phase) noexcept
+    {
+        PerfSample sample;
+        if (!s_Group.Read(sample)) return;
+
+        // While the PMU is shared with other groups the kernel multiplexes; scale
+        // the counts up to the time the group was enabled
+        const u64 enabled = sample.timeEnabled - s_Last.timeEnabled;
+        const u64 running = sample.timeRunning - s_Last.timeRunning;
+        const f64 scale = running > 0 ? static_cast<f64>(enabled) / static_cast<f64>(running) : 0.0;
+
+        std::array<f64, PerfEventCount>& totals = s_Totals[static_cast<usize>(phase)];
+        for (usize i = 0; i < PerfEventCount; ++i) {
+            totals[i] += static_cast<f64>(sample.values[i] - s_Last.values[i]) * scale;
+        }
+
+        s_Last = sample;
+    }
+
+    void PerfCounters::EndFrame()
+    {
+        if (!s_Active) return;
+
+        ++s_Frames;
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now - s_LastReport < std::chrono::duration<f32>(s_Config.reportInterval)) return;
+
+        Report();
+
+        s_Totals = {};
+        s_Frames = 0;
+        s_LastReport = now;
+    }
+
+    void PerfCounters::Report()
+    {
+        if (s_Frames == 0) return;
+
+        const auto ratio = [](PerfEvent event, f64 value, f64 per) -> std::string {
+            if (!s_Group.Has(event) || !s_Group.Has(PerfEvent::Instructions)) return "n/a";
+            return std::format("{:.2f}", per > 0.0 ? value / per : 0.0);
+        };
+
+        LOG_INFO("Perf counters, per frame over {} frames (MPKI = misses per 1000 instructions):", s_Frames);
+
+        for (usize phase = 0; phase < FramePhaseCount; ++phase) {
+            const std::array<f64, PerfEventCount>& totals = s_Totals[phase];
+
+            const f64 cycles = totals[static_cast<usize>(PerfEvent::Cycles)];
+            const f64 instructions = totals[static_cast<usize>(PerfEvent::Instructions)];
+            const f64 kiloInstructions = instructions / 1000.0;
+
+            // Render is skipped while minimized
+            if (cycles <= 0.0) continue;
+
+            LOG_INFO("  {:<8} {:>10.1f}K cycles  IPC {:>5}  L1D MPKI {:>6}  LLC MPKI {:>6}  branch MPKI {:>6}",
+                PhaseNames[phase],
+                cycles / static_cast<f64>(s_Frames) / 1000.0,
+                ratio(PerfEvent::Instructions, instructions, cycles),
+                ratio(PerfEvent::L1DMisses, totals[static_cast<usize>(PerfEvent::L1DMisses)], kiloInstructions),
+                ratio(PerfEvent::LLCMisses, totals[static_cast<usize>(PerfEvent::LLCMisses)], kiloInstructions),
+                ratio(PerfEvent::BranchMisses, totals[static_cast<usize>(PerfEvent::BranchMisses)], kiloInstructions));
+        }
+    }
+
+}
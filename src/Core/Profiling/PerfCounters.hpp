@@ -0,0 +1,130 @@
+#pragma once
+
+namespace Core {
+
+    enum class PerfEvent : u8
+    {
+        Cycles,
+        Instructions,
+        L1DMisses,
+        LLCMisses,
+        BranchMisses
+    };
+
+    inline constexpr usize PerfEventCount = static_cast<usize>(PerfEvent::BranchMisses) + 1;
+
+    struct PerfSample
+    {
+        std::array<u64, PerfEventCount> values {};
+        u64 timeEnabled = 0;
+        u64 timeRunning = 0;
+
+        [[nodiscard]] inline u64 operator[](PerfEvent event) const noexcept { return values[static_cast<usize>(event)]; }
+    };
+
+    // The hardware counters of one thread, read together as a perf_event
+    // group so the values line up. Only user-space events are counted, which
+    // perf_event_paranoid allows up to level 2. Events the CPU or hypervisor
+    // does not offer are left out; only cycles is required.
+    class PerfCounterGroup
+    {
+    public:
+        // Opens the group on the calling thread
+        static std::expected<PerfCounterGroup, std::string> Open();
+
+        PerfCounterGroup() = default;
+        ~PerfCounterGroup();
+
+        PerfCounterGroup(PerfCounterGroup&& other) noexcept;
+        PerfCounterGroup& operator=(PerfCounterGroup&& other) noexcept;
+
+        PerfCounterGroup(const PerfCounterGroup&) = delete;
+        PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+        [[nodiscard]] bool Read(PerfSample& sample) const noexcept;
+
+        [[nodiscard]] inline bool IsOpen() const noexcept { return m_Leader >= 0; }
+        [[nodiscard]] inline bool Has(PerfEvent event) const noexcept { return m_Slots[static_cast<usize>(event)] >= 0; }
+
+    private:
+        void Close() noexcept;
+
+    private:
+        i32 m_Leader = -1;
+        std::array<i32, PerfEventCount> m_Fds { -1, -1, -1, -1, -1 };
+
+        // Position of each event in the group read, -1 when it could not be opened
+        std::array<i8, PerfEventCount> m_Slots { -1, -1, -1, -1, -1 };
+        u32 m_Count = 0;
+    };
+
+    // Phases of Application::Run, in the order they run
+    enum class FramePhase : u8
+    {
+        Poll,
+        Input,
+        IO,
+        Events,
+        Timers,
+        Tasks,
+        Render,
+        Deferred,
+        Metrics
+    };
+
+    inline constexpr usize FramePhaseCount = static_cast<usize>(FramePhase::Metrics) + 1;
+
+    struct PerfCountersConfig
+    {
+        bool enabled = false;
+        f32 reportInterval = 5.0f;  // Seconds between log reports
+    };
+
+    // Per-phase hardware counters for the main loop. The group is read once
+    // at every phase boundary, so a disabled or unavailable group costs one
+    // branch per phase. Every reportInterval the per-frame averages of each
+    // phase are logged: cycles, IPC and misses per thousand instructions.
+    class PerfCounters
+    {
+        friend class Application;
+    public:
+        using Config = PerfCountersConfig;
+
+        [[nodiscard]] inline static bool IsActive() noexcept { return s_Active; }
+        [[nodiscard]] static std::string_view GetPhaseName(FramePhase phase) noexcept;
+
+    protected:
+        // Opens the group on the calling thread, which must be the one running the frame loop
+        static void Init(const Config& config);
+        static void Shutdown();
+
+        inline static void BeginFrame() noexcept
+        {
+            if (s_Active) (void)s_Group.Read(s_Last);
+        }
+
+        // Everything counted since the previous boundary goes to this phase
+        inline static void EndPhase(FramePhase phase) noexcept
+        {
+            if (s_Active) Accumulate(phase);
+        }
+
+        static void EndFrame();
+
+    private:
+        static void Accumulate(FramePhase phase) noexcept;
+        static void Report();
+
+    private:
+        inline static bool s_Active = false;
+        inline static Config s_Config;
+
+        inline static PerfCounterGroup s_Group;
+        inline static PerfSample s_Last;
+
+        inline static std::array<std::array<f64, PerfEventCount>, FramePhaseCount> s_Totals {};
+        inline static u64 s_Frames = 0;
+        inline static std::chrono::steady_clock::time_point s_LastReport;
+    };
+
+}
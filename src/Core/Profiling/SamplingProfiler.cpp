@@ -0,0 +1,442 @@
+#include "SamplingProfiler.hpp"
+
+#include "StackWalk.hpp"
+
+#include "Core/Threading.hpp"
+
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+    #include <pthread.h>
+    #include <signal.h>
+    #include <time.h>
+    #include <unistd.h>
+
+    // glibc only exposes the target thread of SIGEV_THREAD_ID under its internal name
+    #if !defined(sigev_notify_thread_id)
+        #define sigev_notify_thread_id _sigev_un._tid
+    #endif
+
+    #define SAMPLING_PROFILER_SUPPORTED 1
+#endif
+
+namespace Core {
+
+#if defined(SAMPLING_PROFILER_SUPPORTED)
+    namespace {
+
+        struct ThreadSlot
+        {
+            // Written by the signal handler on the owning thread, read by Stop
+            // once sampling is off and no handler is inside
+            std::atomic<bool> sampling = false;
+            uintptr_t* buffer = nullptr;
+            usize capacity = 0;
+            usize size = 0;
+            u64 samples = 0;
+            u64 dropped = 0;
+
+            StackBounds stack;
+
+            // Guarded by s_Mutex
+            bool used = false;
+            bool exited = false;
+            bool armed = false;
+            pthread_t thread {};
+            pid_t tid = 0;
+            timer_t timer {};
+            std::array<char, 32> name {};
+            std::vector<uintptr_t> storage;
+        };
+
+        std::mutex s_Mutex;
+        std::array<ThreadSlot, SamplingProfiler::MaxThreads> s_Slots;
+        SamplingProfilerConfig s_Config;
+        bool s_HandlerInstalled = false;
+        u32 s_ProfileCount = 0;
+
+        std::atomic<bool> s_Active = false;
+        std::atomic<i64> s_DeadlineNs = 0;
+
+        thread_local ThreadSlot* t_Slot = nullptr;
+
+        // Samples are stored as [depth, pc, return address...], innermost frame first
+        void OnProfileSignal(i32, siginfo_t*, void* context)
+        {
+            ThreadSlot* slot = t_Slot;
+            if (!slot) return;
+
+            slot->sampling.store(true);
+
+            if (s_Active.load()) {
+                const usize room = slot->capacity - slot->size;
+                if (room < 2) {
+                    ++slot->dropped;
+                } else {
+                    const std::span<uintptr_t> frames(slot->buffer + slot->size + 1, std::min(room - 1, SamplingProfiler::MaxDepth));
+                    const usize depth = WalkSignalStack(context, slot->stack, frames);
+
+                    slot->buffer[slot->size] = depth;
+                    slot->size += depth + 1;
+                    ++slot->samples;
+                }
+            }
+
+            slot->sampling.store(false);
+        }
+
+        void PrepareSlot(ThreadSlot& slot)
+        {
+            slot.storage.assign(std::max<usize>(s_Config.bufferSize / sizeof(uintptr_t), 2), 0);
+            slot.buffer = slot.storage.data();
+            slot.capacity = slot.storage.size();
+            slot.size = 0;
+            slot.samples = 0;
+            slot.dropped = 0;
+        }
+
+        void ReleaseSlot(ThreadSlot& slot)
+        {
+            slot.storage = {};
+            slot.buffer = nullptr;
+            slot.capacity = 0;
+            slot.size = 0;
+            slot.used = false;
+            slot.exited = false;
+        }
+
+        bool ArmTimer(ThreadSlot& slot)
+        {
+            clockid_t clock;
+            if (const i32 result = pthread_getcpuclockid(slot.thread, &clock); result != 0) {
+                LOG_WARN("Profiler: no CPU clock for thread \"{}\": {}", slot.name.data(), std::strerror(result));
+                return false;
+            }
+
+            sigevent event {};
+            event.sigev_notify = SIGEV_THREAD_ID;
+            event.sigev_signo = SIGPROF;
+            event.sigev_notify_thread_id = slot.tid;
+
+            if (timer_create(clock, &event, &slot.timer) != 0) {
+                LOG_WARN("Profiler: timer_create failed for thread \"{}\": {}", slot.name.data(), std::strerror(errno));
+                return false;
+            }
+
+            const i64 intervalNs = std::max<i64>(1'000'000'000 / s_Config.frequency, 1);
+
+            itimerspec spec {};
+            spec.it_interval.tv_sec = static_cast<time_t>(intervalNs / 1'000'000'000);
+            spec.it_interval.tv_nsec = static_cast<long>(intervalNs % 1'000'000'000);
+            spec.it_value = spec.it_interval;
+
+            if (timer_settime(slot.timer, 0, &spec, nullptr) != 0) {
+                LOG_WARN("Profiler: timer_settime failed for thread \"{}\": {}", slot.name.data(), std::strerror(errno));
+                timer_delete(slot.timer);
+                return false;
+            }
+
+            slot.armed = true;
+            return true;
+        }
+
+        void DisarmTimer(ThreadSlot& slot)
+        {
+            if (!slot.armed) return;
+
+            timer_delete(slot.timer);
+            slot.armed = false;
+        }
+
+        void UnregisterThread()
+        {
+            ThreadSlot* slot = t_Slot;
+            if (!slot) return;
+
+            // From here on the handler ignores this thread
+            t_Slot = nullptr;
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+
+            std::scoped_lock lock(s_Mutex);
+            DisarmTimer(*slot);
+
+            // Samples of a thread that exits mid-profile still go into it
+            if (s_Active.load()) {
+                slot->exited = true;
+            } else {
+                ReleaseSlot(*slot);
+            }
+        }
+
+        struct ThreadExitGuard
+        {
+            ~ThreadExitGuard()
+            {
+                UnregisterThread();
+            }
+        };
+
+        // Names are cached per address, a profile repeats the same few thousand frames
+        class Symbolizer
+        {
+        public:
+            const std::string& Resolve(uintptr_t address)
+            {
+                auto [it, inserted] = m_Names.try_emplace(address);
+                if (inserted) {
+                    it->second = Lookup(address);
+                }
+                return it->second;
+            }
+
+        private:
+            static std::string Lookup(uintptr_t address)
+            {
+                // ';' separates frames in the folded format
+                std::string name = SymbolizeAddress(address);
+                std::ranges::replace(name, ';', ':');
+                return name;
+            }
+
+        private:
+            std::unordered_map<uintptr_t, std::string> m_Names;
+        };
+
+    }
+#endif
+
+    std::expected<void, std::string> SamplingProfiler::Start(const Config& config)
+    {
+#if defined(SAMPLING_PROFILER_SUPPORTED)
+        if (config.frequency == 0) {
+            return std::unexpected("Sampling frequency must be above zero");
+        }
+
+        std::scoped_lock lock(s_Mutex);
+
+        if (s_Active.load()) {
+            return std::unexpected("Profiler is already running");
+        }
+
+        if (!s_HandlerInstalled) {
+            // Stays installed; a SIGPROF still pending after Stop must not hit the default action, which terminates
+            struct sigaction action {};
+            action.sa_sigaction = &OnProfileSignal;
+            action.sa_flags = SA_SIGINFO | SA_RESTART;
+            sigemptyset(&action.sa_mask);
+
+            if (sigaction(SIGPROF, &action, nullptr) != 0) {
+                return std::unexpected(std::string("Failed to install the SIGPROF handler: ") + std::strerror(errno));
+            }
+            s_HandlerInstalled = true;
+        }
+
+        s_Config = config;
+
+        for (ThreadSlot& slot : s_Slots) {
+            if (slot.used) PrepareSlot(slot);
+        }
+
+        s_Active.store(true);
+
+        usize registered = 0;
+        usize armed = 0;
+
+        for (ThreadSlot& slot : s_Slots) {
+            if (!slot.used) continue;
+
+            ++registered;
+            armed += ArmTimer(slot) ? 1 : 0;
+        }
+
+        if (registered > 0 && armed == 0) {
+            s_Active.store(false);
+            return std::unexpected("No thread could be sampled, see the log for details");
+        }
+
+        const i64 deadline = config.duration > 0.0f
+            ? std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch() + std::chrono::duration<f32>(config.duration)
+            ).count()
+            : 0;
+        s_DeadlineNs.store(deadline, std::memory_order_relaxed);
+
+        if (config.duration > 0.0f) {
+            LOG_INFO("Profiler: sampling {} thread(s) at {} Hz for {:.1f}s", armed, config.frequency, config.duration);
+        } else {
+            LOG_INFO("Profiler: sampling {} thread(s) at {} Hz", armed, config.frequency);
+        }
+
+        return {};
+#else
+        (void)config;
+        return std::unexpected("The sampling profiler is only available on Linux x86-64 and AArch64");
+#endif
+    }
+
+    std::expected<std::filesystem::path, std::string> SamplingProfiler::Stop()
+    {
+#if defined(SAMPLING_PROFILER_SUPPORTED)
+        std::scoped_lock lock(s_Mutex);
+
+        if (!s_Active.load()) {
+            return std::unexpected("Profiler is not running");
+        }
+
+        s_Active.store(false);
+        s_DeadlineNs.store(0, std::memory_order_relaxed);
+
+        for (ThreadSlot& slot : s_Slots) {
+            DisarmTimer(slot);
+        }
+
+        // A handler that saw the profile active may still be writing its sample
+        for (ThreadSlot& slot : s_Slots) {
+            while (slot.sampling.load()) {
+                std::this_thread::yield();
+            }
+        }
+
+        Symbolizer symbolizer;
+        std::map<std::string, u64> stacks;
+
+        u64 samples = 0;
+        u64 dropped = 0;
+        usize threads = 0;
+
+        for (ThreadSlot& slot : s_Slots) {
+            if (!slot.used) continue;
+
+            samples += slot.samples;
+            dropped += slot.dropped;
+            threads += slot.samples > 0 ? 1 : 0;
+
+            const std::string root = slot.name[0] != '\0' ? std::string(slot.name.data()) : std::format("thread-{}", slot.tid);
+
+            for (usize offset = 0; offset < slot.size;) {
+                const usize depth = slot.buffer[offset];
+                const uintptr_t* frames = slot.buffer + offset + 1;
+                offset += depth + 1;
+
+                std::string stack = root;
+                for (usize i = depth; i-- > 0;) {
+                    // Return addresses point past the call, look up the call itself
+                    stack += ';';
+                    stack += symbolizer.Resolve(i == 0 ? frames[i] : frames[i] - 1);
+                }
+
+                ++stacks[std::move(stack)];
+            }
+
+            if (slot.exited) {
+                ReleaseSlot(slot);
+            } else {
+                slot.storage = {};
+                slot.buffer = nullptr;
+                slot.capacity = 0;
+                slot.size = 0;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(s_Config.outputDirectory, error);
+
+        const std::filesystem::path path = s_Config.outputDirectory / std::format("Profile-{}-{}.folded", getpid(), ++s_ProfileCount);
+
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            return std::unexpected("Failed to open " + path.string());
+        }
+
+        for (const auto& [stack, count] : stacks) {
+            file << stack << ' ' << count << '\n';
+        }
+
+        if (!file) {
+            return std::unexpected("Failed to write " + path.string());
+        }
+
+        LOG_INFO("Profiler: wrote {} samples from {} thread(s) to {}", samples, threads, path.string());
+        if (dropped > 0) {
+            LOG_WARN("Profiler: dropped {} samples, raise bufferSize for longer profiles", dropped);
+        }
+
+        return path;
+#else
+        return std::unexpected("Profiler is not running");
+#endif
+    }
+
+    bool SamplingProfiler::IsRunning() noexcept
+    {
+#if defined(SAMPLING_PROFILER_SUPPORTED)
+        return s_Active.load(std::memory_order_relaxed);
+#else
+        return false;
+#endif
+    }
+
+    void SamplingProfiler::RegisterThread()
+    {
+#if defined(SAMPLING_PROFILER_SUPPORTED)
+        if (t_Slot) return;
+
+        std::scoped_lock lock(s_Mutex);
+
+        const auto free = std::ranges::find_if(s_Slots, [](const ThreadSlot& slot) { return !slot.used; });
+        if (free == s_Slots.end()) {
+            LOG_WARN("Profiler: more than {} threads, \"{}\" will not be sampled", MaxThreads, Threading::GetThreadName());
+            return;
+        }
+
+        ThreadSlot& slot = *free;
+        slot.used = true;
+        slot.exited = false;
+        slot.thread = pthread_self();
+        slot.tid = gettid();
+
+        const std::string_view name = Threading::GetThreadName();
+        const usize length = std::min(name.size(), slot.name.size() - 1);
+        std::memcpy(slot.name.data(), name.data(), length);
+        slot.name[length] = '\0';
+
+        slot.stack = GetCurrentStackBounds();
+
+        if (s_Active.load()) {
+            PrepareSlot(slot);
+        }
+
+        t_Slot = &slot;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+
+        if (s_Active.load()) {
+            ArmTimer(slot);
+        }
+
+        thread_local ThreadExitGuard guard;
+#endif
+    }
+
+    void SamplingProfiler::Update()
+    {
+#if defined(SAMPLING_PROFILER_SUPPORTED)
+        const i64 deadline = s_DeadlineNs.load(std::memory_order_relaxed);
+        if (deadline == 0) return;
+
+        const i64 now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        if (now < deadline) return;
+
+        if (auto result = Stop(); !result) {
+            LOG_ERROR("Profiler: {}", result.error());
+        }
+#endif
+    }
+
+    void SamplingProfiler::Shutdown()
+    {
+        if (!IsRunning()) return;
+
+        if (auto result = Stop(); !result) {
+            LOG_ERROR("Profiler: {}", result.error());
+        }
+    }
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+namespace Core {
+
+    struct SamplingProfilerConfig
+    {
+        u32 frequency = 1000;                       // Samples per second of each thread's CPU time, capped by the kernel tick rate
+        f32 duration = 0.0f;                        // Seconds before stopping on its own, 0 runs until Stop
+        usize bufferSize = 4 * 1024 * 1024;         // Bytes of stack addresses per thread
+        std::filesystem::path outputDirectory = "profiles";
+    };
+
+    // In-process sampling profiler for threads that went through
+    // Threading::Topology::Apply. While running, each thread has a timer on
+    // its own CPU-time clock that raises SIGPROF; the handler walks the frame
+    // pointers into a buffer allocated by Start and does nothing else.
+    // Stop symbolizes the samples and writes folded stacks, one
+    // "thread;outer;...;inner count" line per unique stack, the input format
+    // of flamegraph.pl and speedscope. Linux only; stacks need frame pointers,
+    // which CMakeLists.txt keeps for this target.
+    class SamplingProfiler
+    {
+        friend class Application;
+    public:
+        using Config = SamplingProfilerConfig;
+
+        static constexpr usize MaxThreads = 64;
+        static constexpr usize MaxDepth = 128;
+
+    public:
+        static std::expected<void, std::string> Start(const Config& config = Config());
+
+        // Returns the path of the written profile
+        static std::expected<std::filesystem::path, std::string> Stop();
+
+        [[nodiscard]] static bool IsRunning() noexcept;
+
+        // Threads registered while a profile runs join it. The calling thread
+        // unregisters itself when it exits.
+        static void RegisterThread();
+
+    protected:
+        // Stops the profile once its duration ran out
+        static void Update();
+        static void Shutdown();
+    };
+
+}
@@ -0,0 +1,99 @@
+#include "StackWalk.hpp"
+
+#if defined(__linux__)
+    #include <cxxabi.h>
+    #include <dlfcn.h>
+    #include <pthread.h>
+    #include <ucontext.h>
+#endif
+
+namespace Core {
+
+    StackBounds GetCurrentStackBounds()
+    {
+        StackBounds bounds;
+
+#if defined(__linux__)
+        pthread_attr_t attributes;
+        if (pthread_getattr_np(pthread_self(), &attributes) == 0) {
+            void* stack = nullptr;
+            size_t size = 0;
+            if (pthread_attr_getstack(&attributes, &stack, &size) == 0) {
+                bounds.low = reinterpret_cast<uintptr_t>(stack);
+                bounds.high = bounds.low + size;
+            }
+            pthread_attr_destroy(&attributes);
+        }
+#endif
+
+        return bounds;
+    }
+
+    usize WalkSignalStack(const void* signalContext, StackBounds bounds, std::span<uintptr_t> frames) noexcept
+    {
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+        if (frames.empty()) return 0;
+
+        const mcontext_t& machine = static_cast<const ucontext_t*>(signalContext)->uc_mcontext;
+    #if defined(__x86_64__)
+        const uintptr_t pc = static_cast<uintptr_t>(machine.gregs[REG_RIP]);
+        uintptr_t fp = static_cast<uintptr_t>(machine.gregs[REG_RBP]);
+    #else
+        const uintptr_t pc = static_cast<uintptr_t>(machine.pc);
+        uintptr_t fp = static_cast<uintptr_t>(machine.regs[29]);
+    #endif
+
+        usize depth = 0;
+        frames[depth++] = pc;
+
+        // Without stack bounds no frame pointer can be trusted, so only the pc is recorded
+        if (bounds.high <= bounds.low || bounds.high - bounds.low < 2 * sizeof(uintptr_t)) return depth;
+        const uintptr_t lastRecord = bounds.high - 2 * sizeof(uintptr_t);
+
+        // Each frame record is [caller's frame pointer, return address]
+        while (depth < frames.size() && fp >= bounds.low && fp <= lastRecord && fp % alignof(uintptr_t) == 0) {
+            const uintptr_t* record = reinterpret_cast<const uintptr_t*>(fp);
+            const uintptr_t next = record[0];
+            const uintptr_t returnAddress = record[1];
+
+            if (returnAddress == 0) break;
+            frames[depth++] = returnAddress;
+
+            // Callers live at higher addresses, anything else is garbage
+            if (next <= fp) break;
+            fp = next;
+        }
+
+        return depth;
+#else
+        (void)signalContext;
+        (void)bounds;
+        (void)frames;
+        return 0;
+#endif
+    }
+
+    std::string SymbolizeAddress(uintptr_t address)
+    {
+#if defined(__linux__)
+        Dl_info info {};
+        if (dladdr(reinterpret_cast<void*>(address), &info) != 0) {
+            if (info.dli_sname) {
+                i32 status = 0;
+                char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+                std::string name = status == 0 && demangled ? demangled : info.dli_sname;
+                std::free(demangled);
+                return name;
+            }
+
+            const std::string_view module = info.dli_fname ? info.dli_fname : "?";
+            const usize slash = module.rfind('/');
+            return std::format("{}+0x{:x}", module.substr(slash == std::string_view::npos ? 0 : slash + 1),
+                address - reinterpret_cast<uintptr_t>(info.dli_fbase));
+        }
+#endif
+
+        return std::format("0x{:x}", address);
+    }
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+namespace Core {
+
+    struct StackBounds
+    {
+        uintptr_t low = 0;
+        uintptr_t high = 0;
+    };
+
+    // Stack of the calling thread, empty where the platform cannot tell
+    [[nodiscard]] StackBounds GetCurrentStackBounds();
+
+    // Walks the frame pointers of the thread a signal interrupted, starting at
+    // the context an SA_SIGINFO handler receives. Writes the interrupted pc,
+    // then one return address per caller, innermost first, and returns the
+    // count. The walk ends at the first frame outside bounds, so it cannot
+    // fault; nothing else is touched, so it is safe inside a signal handler.
+    usize WalkSignalStack(const void* signalContext, StackBounds bounds, std::span<uintptr_t> frames) noexcept;
+
+    // Demangled function name, or module+offset when the symbol is not exported.
+    // Pass return addresses minus one so the call itself is looked up.
+    [[nodiscard]] std::string SymbolizeAddress(uintptr_t address);
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+namespace Core {
+
+    // Single-writer, multi-reader snapshot exchange. The writer rotates through
+    // three slots, each guarded by its own sequence counter, so readers on any
+    // thread copy out a complete value without locks and retry only if the
+    // writer lapped them mid-copy.
+    template <typename T>
+        requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+    class SnapshotBuffer
+    {
+    public:
+        SnapshotBuffer() = default;
+
+        SnapshotBuffer(const SnapshotBuffer&) = delete;
+        SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+        inline void Publish(const T& value) noexcept
+        {
+            const u32 next = (m_Latest.load(std::memory_order_relaxed) + 1) % SlotCount;
+            Slot& slot = m_Slots[next];
+
+            const u64 sequence = slot.sequence.load(std::memory_order_relaxed);
+            slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            std::memcpy(&slot.value, &value, sizeof(T));
+
+            slot.sequence.store(sequence + 2, std::memory_order_release);
+            m_Latest.store(next, std::memory_order_release);
+        }
+
+        [[nodiscard]] inline T Read() const noexcept
+        {
+            T copy;
+
+            for (;;) {
+                const Slot& slot = m_Slots[m_Latest.load(std::memory_order_acquire)];
+
+                const u64 before = slot.sequence.load(std::memory_order_acquire);
+                if (before & 1) continue;
+
+                std::memcpy(&copy, &slot.value, sizeof(T));
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (slot.sequence.load(std::memory_order_relaxed) == before) {
+                    return copy;
+                }
+            }
+        }
+
+    private:
+        static constexpr u32 SlotCount = 3;
+
+        struct alignas(64) Slot
+        {
+            std::atomic<u64> sequence = 0;
+            T value {};
+        };
+
+        std::array<Slot, SlotCount> m_Slots {};
+        alignas(64) std::atomic<u32> m_Latest = 0;
+    };
+
+}
@@ -0,0 +1,178 @@
+#include "Task.hpp"
+
+#include "Application.hpp"
+
+namespace Core {
+
+    namespace Detail {
+
+        static std::pmr::unsynchronized_pool_resource& GetFramePool()
+        {
+            static std::pmr::unsynchronized_pool_resource pool(std::pmr::pool_options {
+                .max_blocks_per_chunk = 256,
+                .largest_required_pool_block = 2048
+            });
+
+            return pool;
+        }
+
+        void* TaskFrameAllocator::Allocate(usize size)
+        {
+            return GetFramePool().allocate(size, alignof(std::max_align_t));
+        }
+
+        void TaskFrameAllocator::Deallocate(void* ptr, usize size) noexcept
+        {
+            GetFramePool().deallocate(ptr, size, alignof(std::max_align_t));
+        }
+
+        void TaskPromiseBase::OnDetachedTaskFinished(TaskPromiseBase& promise, std::coroutine_handle<> handle) noexcept
+        {
+            if (promise.exception) {
+                try {
+                    std::rethrow_exception(promise.exception);
+                } catch (const std::exception& e) {
+                    LOG_ERROR("Unhandled exception in task: {}", e.what());
+                } catch (...) {
+                    LOG_ERROR("Unhandled unknown exception in task");
+                }
+            }
+
+            TaskScheduler::Unlink(promise);
+            handle.destroy();
+        }
+
+    }
+
+    void TaskScheduler::Spawn(Task<void>&& task)
+    {
+        auto handle = task.Release();
+        if (!handle) return;
+
+        Detail::TaskPromiseBase& promise = handle.promise();
+        promise.detached = true;
+        promise.prev = nullptr;
+        promise.next = s_Detached;
+
+        if (s_Detached) {
+            s_Detached->prev = &promise;
+        }
+        s_Detached = &promise;
+        ++s_DetachedCount;
+
+        handle.resume();
+    }
+
+    void TaskScheduler::Update()
+    {
+        if (s_NextFrame.empty()) return;
+
+        // Tasks that wait for another frame while resuming land in the fresh list
+        std::swap(s_NextFrame, s_Resuming);
+
+        // Indexed, and skipping cleared entries, because a resumed task may destroy one queued behind it
+        for (usize i = 0; i < s_Resuming.size(); ++i) {
+            if (s_Resuming[i]) s_Resuming[i].resume();
+        }
+
+        s_Resuming.clear();
+    }
+
+    void TaskScheduler::OnEvent(const CoreEvents& event)
+    {
+        auto& waiters = s_EventWaiters[event.index()];
+        if (waiters.empty()) return;
+
+        std::vector<EventWaiter> resuming;
+        std::swap(resuming, s_EventScratch);
+        std::swap(resuming, waiters);
+
+        for (usize i = 0; i < resuming.size(); ++i) {
+            EventInterest::Remove(EventMask { 1 } << event.index());
+        }
+
+        for (const EventWaiter& waiter : resuming) {
+            waiter.deliver(waiter.awaiter, event);
+            waiter.handle.resume();
+        }
+
+        resuming.clear();
+        std::swap(resuming, s_EventScratch);
+    }
+
+    void TaskScheduler::Shutdown()
+    {
+        s_NextFrame.clear();
+        for (usize index = 0; index < s_EventWaiters.size(); ++index) {
+            for (usize i = 0; i < s_EventWaiters[index].size(); ++i) {
+                EventInterest::Remove(EventMask { 1 } << index);
+            }
+            s_EventWaiters[index].clear();
+        }
+
+        while (s_Detached) {
+            Detail::TaskPromiseBase* promise = s_Detached;
+            Unlink(*promise);
+
+            // Only Task<void> can be spawned, so every detached promise is a TaskPromise<void>
+            std::coroutine_handle<Detail::TaskPromise<void>>::from_promise(
+                static_cast<Detail::TaskPromise<void>&>(*promise)
+            ).destroy();
+        }
+    }
+
+    void TaskScheduler::WaitNextFrame(std::coroutine_handle<> handle)
+    {
+        s_NextFrame.push_back(handle);
+    }
+
+    TimerHandle TaskScheduler::WaitDelay(f32 seconds, TimeDomain domain, std::coroutine_handle<> handle)
+    {
+        return Application::GetTimers(domain).Schedule(seconds, [handle] {
+            handle.resume();
+        });
+    }
+
+    void TaskScheduler::WaitEvent(usize index, const EventWaiter& waiter)
+    {
+        s_EventWaiters[index].push_back(waiter);
+
+        // Keep the window producing this event type until the waiter is resumed
+        EventInterest::Add(EventMask { 1 } << index);
+    }
+
+    void TaskScheduler::CancelNextFrame(std::coroutine_handle<> handle) noexcept
+    {
+        std::erase(s_NextFrame, handle);
+        std::ranges::replace(s_Resuming, handle, std::coroutine_handle<> {});
+    }
+
+    void TaskScheduler::CancelDelay(TimeDomain domain, TimerHandle timer) noexcept
+    {
+        Application::GetTimers(domain).Cancel(timer);
+    }
+
+    void TaskScheduler::CancelEvent(usize index, void* awaiter) noexcept
+    {
+        const usize removed = std::erase_if(s_EventWaiters[index], [awaiter](const EventWaiter& waiter) {
+            return waiter.awaiter == awaiter;
+        });
+
+        if (removed > 0) {
+            EventInterest::Remove(EventMask { 1 } << index);
+        }
+    }
+
+    void TaskScheduler::Unlink(Detail::TaskPromiseBase& promise) noexcept
+    {
+        if (promise.prev) promise.prev->next = promise.next;
+        else s_Detached = promise.next;
+
+        if (promise.next) promise.next->prev = promise.prev;
+
+        promise.prev = nullptr;
+        promise.next = nullptr;
+        --s_DetachedCount;
+    }
+
+}
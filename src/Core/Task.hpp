@@ -0,0 +1,333 @@
+#pragma once
+
+#include "TimerWheel.hpp"
+#include "Events/CoreEvents.hpp"
+
+namespace Core {
+
+    template <typename T = void>
+    class Task;
+
+    namespace Detail {
+
+        // Coroutine frames are carved out of a pooled resource. Tasks are
+        // created and resumed on the main thread only, so it is unsynchronized.
+        class TaskFrameAllocator
+        {
+        public:
+            static void* Allocate(usize size);
+            static void Deallocate(void* ptr, usize size) noexcept;
+        };
+
+        struct TaskPromiseBase
+        {
+            std::coroutine_handle<> continuation;
+            std::exception_ptr exception;
+
+            // Detached tasks are owned by the TaskScheduler through this intrusive list
+            bool detached = false;
+            TaskPromiseBase* prev = nullptr;
+            TaskPromiseBase* next = nullptr;
+
+            static void* operator new(usize size)
+            {
+                return TaskFrameAllocator::Allocate(size);
+            }
+
+            static void operator delete(void* ptr, usize size) noexcept
+            {
+                TaskFrameAllocator::Deallocate(ptr, size);
+            }
+
+            struct FinalAwaiter
+            {
+                constexpr bool await_ready() const noexcept { return false; }
+
+                template <typename TPromise>
+                inline std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) noexcept
+                {
+                    TaskPromiseBase& promise = handle.promise();
+
+                    if (promise.continuation) {
+                        return promise.continuation;
+                    }
+
+                    if (promise.detached) {
+                        OnDetachedTaskFinished(promise, handle);
+                    }
+
+                    return std::noop_coroutine();
+                }
+
+                constexpr void await_resume() const noexcept {}
+            };
+
+            constexpr std::suspend_always initial_suspend() const noexcept { return {}; }
+            constexpr FinalAwaiter final_suspend() const noexcept { return {}; }
+
+            inline void unhandled_exception() noexcept
+            {
+                exception = std::current_exception();
+            }
+
+            static void OnDetachedTaskFinished(TaskPromiseBase& promise, std::coroutine_handle<> handle) noexcept;
+        };
+
+        template <typename T>
+        struct TaskPromise final : public TaskPromiseBase
+        {
+            std::optional<T> value;
+
+            inline Task<T> get_return_object() noexcept
+            {
+                return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+            }
+
+            template <typename U>
+                requires std::is_constructible_v<T, U&&>
+            inline void return_value(U&& result)
+            {
+                value.emplace(std::forward<U>(result));
+            }
+        };
+
+        template <>
+        struct TaskPromise<void> final : public TaskPromiseBase
+        {
+            inline Task<void> get_return_object() noexcept;
+
+            constexpr void return_void() const noexcept {}
+        };
+
+    }
+
+    // Lazily started coroutine. Run it by co_await-ing it from another task
+    // (which resumes when it completes) or hand it to TaskScheduler::Spawn.
+    template <typename T>
+    class [[nodiscard]] Task
+    {
+    public:
+        using promise_type = Detail::TaskPromise<T>;
+        using Handle = std::coroutine_handle<promise_type>;
+
+    public:
+        constexpr Task() noexcept = default;
+
+        explicit Task(Handle handle) noexcept
+            : m_Handle(handle) {}
+
+        Task(Task&& other) noexcept
+            : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other) {
+                if (m_Handle) m_Handle.destroy();
+                m_Handle = std::exchange(other.m_Handle, nullptr);
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            if (m_Handle) m_Handle.destroy();
+        }
+
+        [[nodiscard]] inline bool IsValid() const noexcept { return static_cast<bool>(m_Handle); }
+        [[nodiscard]] inline bool IsDone() const noexcept { return m_Handle && m_Handle.done(); }
+
+        inline Handle Release() noexcept
+        {
+            return std::exchange(m_Handle, nullptr);
+        }
+
+        struct Awaiter
+        {
+            Handle handle;
+
+            inline bool await_ready() const noexcept
+            {
+                return !handle || handle.done();
+            }
+
+            inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+            {
+                handle.promise().continuation = continuation;
+                return handle;
+            }
+
+            inline T await_resume()
+            {
+                assert(handle && "Awaiting an empty task");
+
+                if (handle.promise().exception) {
+                    std::rethrow_exception(handle.promise().exception);
+                }
+
+                if constexpr (!std::is_void_v<T>) {
+                    return std::move(*handle.promise().value);
+                }
+            }
+        };
+
+        inline Awaiter operator co_await() & noexcept { return Awaiter { m_Handle }; }
+        inline Awaiter operator co_await() && noexcept { return Awaiter { m_Handle }; }
+
+    private:
+        Handle m_Handle;
+    };
+
+    inline Task<void> Detail::TaskPromise<void>::get_return_object() noexcept
+    {
+        return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    class TaskScheduler
+    {
+        friend class Application;
+        friend struct NextFrameAwaiter;
+        friend struct DelayAwaiter;
+        template <IsEvent T> friend struct EventAwaiter;
+        friend struct Detail::TaskPromiseBase;
+    public:
+        // Starts the task immediately; the scheduler owns it until it completes
+        static void Spawn(Task<void>&& task);
+
+        [[nodiscard]] inline static usize GetDetachedCount() noexcept { return s_DetachedCount; }
+
+    protected:
+        static void Update();
+        static void OnEvent(const CoreEvents& event);
+        static void Shutdown();
+
+    private:
+        struct EventWaiter
+        {
+            std::coroutine_handle<> handle;
+            void* awaiter;
+            void (*deliver)(void* awaiter, const CoreEvents& event);
+        };
+
+        static void WaitNextFrame(std::coroutine_handle<> handle);
+        static TimerHandle WaitDelay(f32 seconds, TimeDomain domain, std::coroutine_handle<> handle);
+        static void WaitEvent(usize index, const EventWaiter& waiter);
+
+        // Called by awaiters destroyed with a suspended task, so the task is never resumed
+        static void CancelNextFrame(std::coroutine_handle<> handle) noexcept;
+        static void CancelDelay(TimeDomain domain, TimerHandle timer) noexcept;
+        static void CancelEvent(usize index, void* awaiter) noexcept;
+
+        static void Unlink(Detail::TaskPromiseBase& promise) noexcept;
+
+    private:
+        inline static std::vector<std::coroutine_handle<>> s_NextFrame;
+        inline static std::vector<std::coroutine_handle<>> s_Resuming;
+
+        inline static std::array<std::vector<EventWaiter>, std::variant_size_v<CoreEvents>> s_EventWaiters;
+        inline static std::vector<EventWaiter> s_EventScratch;
+
+        inline static Detail::TaskPromiseBase* s_Detached = nullptr;
+        inline static usize s_DetachedCount = 0;
+    };
+
+    // The awaiters live in the suspended task's frame. Destroying the task
+    // destroys them, and they withdraw the task from whatever it waits on.
+    struct NextFrameAwaiter
+    {
+        std::coroutine_handle<> waiting;
+
+        inline ~NextFrameAwaiter()
+        {
+            if (waiting) TaskScheduler::CancelNextFrame(waiting);
+        }
+
+        constexpr bool await_ready() const noexcept { return false; }
+
+        inline void await_suspend(std::coroutine_handle<> handle)
+        {
+            waiting = handle;
+            TaskScheduler::WaitNextFrame(handle);
+        }
+
+        inline void await_resume() noexcept
+        {
+            waiting = nullptr;
+        }
+    };
+
+    struct DelayAwaiter
+    {
+        f32 seconds;
+        TimeDomain domain;
+        TimerHandle timer {};
+
+        inline ~DelayAwaiter()
+        {
+            if (timer.IsValid()) TaskScheduler::CancelDelay(domain, timer);
+        }
+
+        constexpr bool await_ready() const noexcept { return seconds <= 0.0f; }
+
+        inline void await_suspend(std::coroutine_handle<> handle)
+        {
+            timer = TaskScheduler::WaitDelay(seconds, domain, handle);
+        }
+
+        inline void await_resume() noexcept
+        {
+            timer = {};
+        }
+    };
+
+    template <IsEvent T>
+    struct EventAwaiter
+    {
+        std::optional<T> event;
+        bool waiting = false;
+
+        inline ~EventAwaiter()
+        {
+            if (waiting) TaskScheduler::CancelEvent(EventIndexOf<T, CoreEvents>, this);
+        }
+
+        constexpr bool await_ready() const noexcept { return false; }
+
+        inline void await_suspend(std::coroutine_handle<> handle)
+        {
+            waiting = true;
+            TaskScheduler::WaitEvent(EventIndexOf<T, CoreEvents>, TaskScheduler::EventWaiter {
+                .handle = handle,
+                .awaiter = this,
+                .deliver = [](void* awaiter, const CoreEvents& e) {
+                    static_cast<EventAwaiter*>(awaiter)->event.emplace(std::get<T>(e));
+                }
+            });
+        }
+
+        inline T await_resume()
+        {
+            waiting = false;
+            return std::move(*event);
+        }
+    };
+
+    [[nodiscard]] inline NextFrameAwaiter NextFrame() noexcept
+    {
+        return NextFrameAwaiter {};
+    }
+
+    [[nodiscard]] inline DelayAwaiter Delay(f32 seconds, TimeDomain domain = TimeDomain::Scaled) noexcept
+    {
+        return DelayAwaiter { seconds, domain };
+    }
+
+    template <IsEvent T>
+    [[nodiscard]] inline EventAwaiter<T> NextEvent() noexcept
+    {
+        return EventAwaiter<T> {};
+    }
+
+}
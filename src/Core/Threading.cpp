@@ -0,0 +1,308 @@
+#include "Threading.hpp"
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+    #include <sys/resource.h>
+    #include <unistd.h>
+#endif
+
+namespace Core::Threading {
+
+    namespace {
+
+        // Linux truncates thread names to 15 characters, keep the full name for the log
+        thread_local std::array<char, 32> t_ThreadName {};
+
+        constexpr std::array<std::string_view, RoleCount> RoleNames {
+            "main",
+            "worker",
+            "io",
+            "background"
+        };
+
+        std::string_view Trim(std::string_view text)
+        {
+            const usize begin = text.find_first_not_of(" \t\r");
+            if (begin == std::string_view::npos) return {};
+
+            const usize end = text.find_last_not_of(" \t\r");
+            return text.substr(begin, end - begin + 1);
+        }
+
+        template <std::integral T>
+        std::optional<T> ParseInteger(std::string_view text)
+        {
+            T value {};
+            auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (ec != std::errc() || ptr != text.data() + text.size()) return std::nullopt;
+            return value;
+        }
+
+        std::optional<std::vector<u32>> ParseCpuList(std::string_view text)
+        {
+            std::vector<u32> cpus;
+
+            while (!text.empty()) {
+                const usize comma = text.find(',');
+                const std::string_view item = text.substr(0, comma);
+                text = comma == std::string_view::npos ? std::string_view() : text.substr(comma + 1);
+
+                const usize dash = item.find('-');
+                const auto first = ParseInteger<u32>(item.substr(0, dash));
+                const auto last = dash == std::string_view::npos ? first : ParseInteger<u32>(item.substr(dash + 1));
+
+                if (!first || !last || *last < *first) return std::nullopt;
+
+                for (u32 cpu = *first; cpu <= *last; ++cpu) {
+                    cpus.push_back(cpu);
+                }
+            }
+
+            std::ranges::sort(cpus);
+            cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+            return cpus;
+        }
+
+        std::string FormatCpuList(std::span<const u32> cpus)
+        {
+            std::string text;
+
+            for (usize i = 0; i < cpus.size();) {
+                usize j = i;
+                while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) ++j;
+
+                if (!text.empty()) text += ',';
+                text += std::to_string(cpus[i]);
+                if (j > i) text += '-' + std::to_string(cpus[j]);
+
+                i = j + 1;
+            }
+
+            return text.empty() ? std::string("any") : text;
+        }
+
+#if defined(__linux__)
+        bool PinCurrentThread(std::span<const u32> cpus)
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+
+            for (u32 cpu : cpus) {
+                if (cpu >= CPU_SETSIZE) {
+                    LOG_WARN("CPU {} is out of range, ignoring it", cpu);
+                    continue;
+                }
+                CPU_SET(cpu, &set);
+            }
+
+            const i32 result = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+            if (result != 0) {
+                LOG_WARN("Failed to pin thread \"{}\" to cpus {}: {}", GetThreadName(), FormatCpuList(cpus), std::strerror(result));
+                return false;
+            }
+
+            return true;
+        }
+
+        // Returns the priority that was applied, clamped to the range SCHED_FIFO supports
+        std::optional<i32> SetRealtimePriority(i32 priority)
+        {
+            sched_param param {};
+            param.sched_priority = std::clamp(priority, sched_get_priority_min(SCHED_FIFO), sched_get_priority_max(SCHED_FIFO));
+
+            const i32 result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+            if (result != 0) {
+                LOG_WARN("Failed to set SCHED_FIFO {} on thread \"{}\": {}", param.sched_priority, GetThreadName(), std::strerror(result));
+                return std::nullopt;
+            }
+
+            return param.sched_priority;
+        }
+
+        bool SetNice(i32 nice)
+        {
+            // On Linux nice values are per thread when addressed by tid
+            if (setpriority(PRIO_PROCESS, static_cast<id_t>(gettid()), nice) != 0) {
+                LOG_WARN("Failed to set nice {} on thread \"{}\": {}", nice, GetThreadName(), std::strerror(errno));
+                return false;
+            }
+
+            return true;
+        }
+#endif
+
+    }
+
+    std::expected<Config, std::string> Config::Parse(std::string_view text)
+    {
+        Config config;
+        usize lineNumber = 0;
+
+        while (!text.empty()) {
+            const usize newline = text.find('\n');
+            std::string_view line = Trim(text.substr(0, newline));
+            text = newline == std::string_view::npos ? std::string_view() : text.substr(newline + 1);
+            ++lineNumber;
+
+            if (line.empty() || line.front() == '#') continue;
+
+            auto error = [&](std::string_view message) {
+                return std::unexpected(std::string("Line ") + std::to_string(lineNumber) + ": " + std::string(message));
+            };
+
+            const usize space = line.find_first_of(" \t");
+            const std::string_view roleName = line.substr(0, space);
+            line = space == std::string_view::npos ? std::string_view() : Trim(line.substr(space));
+
+            const auto role = std::ranges::find(RoleNames, roleName);
+            if (role == RoleNames.end()) return error("unknown thread role");
+
+            RoleConfig& entry = config.roles[static_cast<usize>(role - RoleNames.begin())];
+
+            while (!line.empty()) {
+                const usize end = line.find_first_of(" \t");
+                const std::string_view option = line.substr(0, end);
+                line = end == std::string_view::npos ? std::string_view() : Trim(line.substr(end));
+
+                const usize equals = option.find('=');
+                if (equals == std::string_view::npos) return error("expected \"<option>=<value>\"");
+
+                const std::string_view key = option.substr(0, equals);
+                const std::string_view value = option.substr(equals + 1);
+
+                if (key == "cpus") {
+                    auto cpus = ParseCpuList(value);
+                    if (!cpus) return error("invalid cpu list");
+                    entry.cpus = std::move(*cpus);
+                } else if (key == "nice") {
+                    entry.nice = ParseInteger<i32>(value);
+                    if (!entry.nice || *entry.nice < -20 || *entry.nice > 19) return error("nice must be in [-20, 19]");
+                } else if (key == "realtime") {
+                    entry.realtimePriority = ParseInteger<i32>(value);
+                    if (!entry.realtimePriority || *entry.realtimePriority < 1) return error("invalid realtime priority");
+                } else {
+                    return error("unknown option");
+                }
+            }
+        }
+
+        return config;
+    }
+
+    std::expected<Config, std::string> Config::LoadFromFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path);
+        if (!file) {
+            return std::unexpected("Failed to open " + path.string());
+        }
+
+        std::stringstream contents;
+        contents << file.rdbuf();
+
+        return Parse(contents.str());
+    }
+
+    std::string_view GetRoleName(ThreadRole role) noexcept
+    {
+        return RoleNames[static_cast<usize>(role)];
+    }
+
+    void SetThreadName(std::string_view name)
+    {
+        const usize length = std::min(name.size(), t_ThreadName.size() - 1);
+        std::memcpy(t_ThreadName.data(), name.data(), length);
+        t_ThreadName[length] = '\0';
+
+#if defined(__linux__)
+        char shortName[16] {};
+        std::memcpy(shortName, name.data(), std::min(name.size(), sizeof(shortName) - 1));
+        pthread_setname_np(pthread_self(), shortName);
+#endif
+    }
+
+    std::string_view GetThreadName() noexcept
+    {
+        return std::string_view(t_ThreadName.data());
+    }
+
+    void Topology::Configure(const Config& config)
+    {
+        std::scoped_lock lock(s_Mutex);
+        s_Config = config;
+
+#if defined(__linux__)
+        // Online cpus need not be numbered densely (offline cpus, cpusets, SMT off), so check the
+        // process's affinity mask rather than a count. Pinning reports anything that changed since.
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        const bool known = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+        if (!known) {
+            LOG_WARN("sched_getaffinity failed, cpu lists are not checked: {}", std::strerror(errno));
+        }
+
+        for (RoleConfig& role : s_Config.roles) {
+            const auto invalid = std::ranges::remove_if(role.cpus, [&](u32 cpu) {
+                return cpu >= CPU_SETSIZE || (known && !CPU_ISSET(cpu, &allowed));
+            });
+            if (!invalid.empty()) {
+                LOG_WARN("Ignoring cpu(s) {}, not available to this process", FormatCpuList(std::vector<u32>(invalid.begin(), invalid.end())));
+                role.cpus.erase(invalid.begin(), invalid.end());
+            }
+        }
+#endif
+    }
+
+    void Topology::AddStartHook(StartHook hook)
+    {
+        std::scoped_lock lock(s_Mutex);
+        if (std::ranges::find(s_StartHooks, hook) == s_StartHooks.end()) {
+            s_StartHooks.push_back(hook);
+        }
+    }
+
+    void Topology::Apply(ThreadRole role, std::string_view name)
+    {
+        SetThreadName(name);
+
+        RoleConfig config;
+        std::vector<StartHook> hooks;
+        {
+            std::scoped_lock lock(s_Mutex);
+            config = s_Config[role];
+            hooks = s_StartHooks;
+        }
+
+        bool pinned = false;
+        std::string priority = "default";
+
+#if defined(__linux__)
+        if (!config.cpus.empty()) {
+            pinned = PinCurrentThread(config.cpus);
+        }
+
+        if (config.realtimePriority) {
+            if (std::optional<i32> applied = SetRealtimePriority(*config.realtimePriority)) {
+                priority = "SCHED_FIFO " + std::to_string(*applied);
+            }
+        } else if (config.nice) {
+            if (SetNice(*config.nice)) {
+                priority = "nice " + std::to_string(*config.nice);
+            }
+        }
+
+        const i64 id = gettid();
+#else
+        const i64 id = 0;
+#endif
+
+        LOG_INFO("Thread \"{}\" (tid {}, role {}): cpus {}, priority {}",
+            name, id, GetRoleName(role), pinned ? FormatCpuList(config.cpus) : std::string("any"), priority);
+
+        for (StartHook hook : hooks) {
+            hook();
+        }
+    }
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+namespace Core::Threading {
+
+    enum class ThreadRole : u8
+    {
+        Main,
+        Worker,
+        IO,
+        Background
+    };
+
+    inline constexpr usize RoleCount = static_cast<usize>(ThreadRole::Background) + 1;
+
+    // Placement for every thread of one role. Empty fields leave the scheduler's defaults alone.
+    struct RoleConfig
+    {
+        std::vector<u32> cpus;
+        std::optional<i32> nice;
+        std::optional<i32> realtimePriority;
+    };
+
+    struct Config
+    {
+        std::array<RoleConfig, RoleCount> roles;
+
+        [[nodiscard]] inline RoleConfig& operator[](ThreadRole role) noexcept { return roles[static_cast<usize>(role)]; }
+        [[nodiscard]] inline const RoleConfig& operator[](ThreadRole role) const noexcept { return roles[static_cast<usize>(role)]; }
+
+        // Parses lines of the form:
+        //   main    cpus=2       nice=-5
+        //   worker  cpus=4-7,10
+        //   io      cpus=3       realtime=10
+        // Blank lines and lines starting with '#' are ignored.
+        static std::expected<Config, std::string> Parse(std::string_view text);
+        static std::expected<Config, std::string> LoadFromFile(const std::filesystem::path& path);
+    };
+
+    [[nodiscard]] std::string_view GetRoleName(ThreadRole role) noexcept;
+
+    // Names the calling thread for the log pattern (%N), debuggers and profilers
+    void SetThreadName(std::string_view name);
+    [[nodiscard]] std::string_view GetThreadName() noexcept;
+
+    class Topology
+    {
+    public:
+        using StartHook = void (*)();
+
+        static void Configure(const Config& config);
+
+        // Runs at the end of every Apply, on the thread being set up. Threads
+        // started before the hook was added are not revisited.
+        static void AddStartHook(StartHook hook);
+
+        // Names the calling thread, then pins it and sets its priority as configured
+        // for the role. Failures are logged and leave the thread as it was.
+        static void Apply(ThreadRole role, std::string_view name);
+
+    private:
+        inline static std::mutex s_Mutex;
+        inline static Config s_Config;
+        inline static std::vector<StartHook> s_StartHooks;
+    };
+
+}
@@ -51,6 +51,12 @@ namespace Core {
             return m_TotalTime.count();
         }
 
+        // Unscaled time since the last Tick, i.e. how far into the current frame we are
+        [[nodiscard]] inline f32 GetTimeSinceTick() const noexcept
+        {
+            return FloatDuration(Clock::now() - m_LastFrameTime).count();
+        }
+
     private:
         using Clock = std::chrono::steady_clock;
         using TimePoint = std::chrono::time_point<Clock>;
@@ -0,0 +1,253 @@
+#include "TimerWheel.hpp"
+
+namespace Core {
+
+    TimerWheel::TimerWheel(f32 resolution)
+        : m_Resolution(resolution)
+    {
+        m_Lists.fill(InvalidIndex);
+    }
+
+    TimerHandle TimerWheel::Schedule(f32 delay, Callback callback)
+    {
+        return Insert(ToTicks(delay), 0, std::move(callback));
+    }
+
+    TimerHandle TimerWheel::ScheduleRepeating(f32 interval, Callback callback)
+    {
+        return ScheduleRepeating(interval, interval, std::move(callback));
+    }
+
+    TimerHandle TimerWheel::ScheduleRepeating(f32 firstDelay, f32 interval, Callback callback)
+    {
+        // An interval of zero ticks would make it a one-shot
+        return Insert(ToTicks(firstDelay), std::max<u64>(ToTicks(interval), 1), std::move(callback));
+    }
+
+    bool TimerWheel::Cancel(TimerHandle handle)
+    {
+        if (!IsPending(handle)) return false;
+
+        // Timers already collected for this frame's batch are skipped by the generation check
+        if (m_Nodes[handle.index].list != NoList) {
+            Unlink(handle.index);
+        }
+
+        Free(handle.index);
+        return true;
+    }
+
+    bool TimerWheel::IsPending(TimerHandle handle) const
+    {
+        return handle.index < m_Nodes.size()
+            && m_Nodes[handle.index].generation == handle.generation
+            && (m_Nodes[handle.index].callback || m_Nodes[handle.index].running);
+    }
+
+    void TimerWheel::Advance(f32 deltaTime)
+    {
+        m_Time += deltaTime;
+        const u64 target = static_cast<u64>(m_Time / m_Resolution);
+
+        while (m_CurrentTick < target) {
+            if (m_PendingCount == 0) {
+                m_CurrentTick = target;
+                break;
+            }
+
+            const u64 next = m_CurrentTick + 1;
+
+            // Nothing due in the current level 0 revolution, skip straight to its last tick
+            if ((next & SlotMask) != 0 && m_Occupied[0] == 0) {
+                m_CurrentTick = std::min(target, next | SlotMask);
+                continue;
+            }
+
+            m_CurrentTick = next;
+
+            if ((next & SlotMask) == 0) {
+                u32 level = 1;
+                while (level < Levels && ((next >> (SlotBits * level)) & SlotMask) == 0) {
+                    ++level;
+                }
+
+                if (level == Levels) {
+                    Cascade(OverflowList);
+                }
+
+                // Higher levels first so their timers can land in the lower slots cascaded below
+                for (u32 l = std::min(level, Levels - 1); l >= 1; --l) {
+                    Cascade(l * SlotCount + static_cast<u32>((next >> (SlotBits * l)) & SlotMask));
+                }
+            }
+
+            Expire(static_cast<u32>(next & SlotMask));
+        }
+
+        if (m_Expired.empty()) return;
+
+        std::vector<u32> expired;
+        std::swap(expired, m_Expired);
+
+        for (u32 index : expired) {
+            if (!m_Nodes[index].callback || m_Nodes[index].list != NoList) continue;
+
+            // The callback may schedule timers, which can reallocate m_Nodes, or cancel
+            // its own timer, so it runs from a local and the node is looked up again after
+            const u32 generation = m_Nodes[index].generation;
+            Callback callback = std::move(m_Nodes[index].callback);
+            m_Nodes[index].callback = nullptr;
+            m_Nodes[index].running = true;
+
+            callback();
+
+            // Cancelled, or cancelled and reused
+            Node& node = m_Nodes[index];
+            if (node.generation != generation) continue;
+
+            node.running = false;
+            node.callback = std::move(callback);
+
+            if (node.interval > 0) {
+                node.expiry = std::max(node.expiry + node.interval, m_CurrentTick + 1);
+                Link(index);
+            } else {
+                Free(index);
+            }
+        }
+
+        expired.clear();
+        if (m_Expired.empty()) {
+            std::swap(expired, m_Expired);
+        }
+    }
+
+    TimerHandle TimerWheel::Insert(u64 delayTicks, u64 intervalTicks, Callback&& callback)
+    {
+        assert(callback && "Scheduling an empty timer callback");
+
+        u32 index;
+        if (!m_FreeNodes.empty()) {
+            index = m_FreeNodes.back();
+            m_FreeNodes.pop_back();
+        } else {
+            index = static_cast<u32>(m_Nodes.size());
+            m_Nodes.emplace_back();
+        }
+
+        Node& node = m_Nodes[index];
+        node.callback = std::move(callback);
+        node.expiry = m_CurrentTick + std::max<u64>(delayTicks, 1);
+        node.interval = intervalTicks;
+
+        Link(index);
+        ++m_PendingCount;
+
+        return TimerHandle { index, node.generation };
+    }
+
+    void TimerWheel::Link(u32 index)
+    {
+        Node& node = m_Nodes[index];
+
+        // The level is picked from the highest 6-bit group in which the expiry
+        // differs from the current tick, so each slot is reached exactly once
+        const u64 diff = node.expiry ^ m_CurrentTick;
+
+        u32 list = OverflowList;
+        for (u32 level = 0; level < Levels; ++level) {
+            if (diff < (u64(1) << (SlotBits * (level + 1)))) {
+                const u32 slot = static_cast<u32>((node.expiry >> (SlotBits * level)) & SlotMask);
+                list = level * SlotCount + slot;
+                m_Occupied[level] |= u64(1) << slot;
+                break;
+            }
+        }
+
+        node.list = list;
+        node.prev = InvalidIndex;
+        node.next = m_Lists[list];
+
+        if (node.next != InvalidIndex) {
+            m_Nodes[node.next].prev = index;
+        }
+        m_Lists[list] = index;
+    }
+
+    void TimerWheel::Unlink(u32 index)
+    {
+        Node& node = m_Nodes[index];
+
+        if (node.prev != InvalidIndex) {
+            m_Nodes[node.prev].next = node.next;
+        } else {
+            m_Lists[node.list] = node.next;
+        }
+
+        if (node.next != InvalidIndex) {
+            m_Nodes[node.next].prev = node.prev;
+        }
+
+        if (node.list < OverflowList && m_Lists[node.list] == InvalidIndex) {
+            m_Occupied[node.list / SlotCount] &= ~(u64(1) << (node.list % SlotCount));
+        }
+
+        node.list = NoList;
+        node.prev = InvalidIndex;
+        node.next = InvalidIndex;
+    }
+
+    void TimerWheel::Free(u32 index)
+    {
+        Node& node = m_Nodes[index];
+        node.callback = nullptr;
+        node.running = false;
+        node.generation++;
+
+        m_FreeNodes.push_back(index);
+        --m_PendingCount;
+    }
+
+    void TimerWheel::Cascade(u32 list)
+    {
+        u32 index = m_Lists[list];
+
+        m_Lists[list] = InvalidIndex;
+        if (list < OverflowList) {
+            m_Occupied[list / SlotCount] &= ~(u64(1) << (list % SlotCount));
+        }
+
+        while (index != InvalidIndex) {
+            const u32 next = m_Nodes[index].next;
+            Link(index);
+            index = next;
+        }
+    }
+
+    void TimerWheel::Expire(u32 list)
+    {
+        u32 index = m_Lists[list];
+        if (index == InvalidIndex) return;
+
+        m_Lists[list] = InvalidIndex;
+        m_Occupied[0] &= ~(u64(1) << list);
+
+        while (index != InvalidIndex) {
+            Node& node = m_Nodes[index];
+            const u32 next = node.next;
+
+            node.list = NoList;
+            node.prev = InvalidIndex;
+            node.next = InvalidIndex;
+            m_Expired.push_back(index);
+
+            index = next;
+        }
+    }
+
+    u64 TimerWheel::ToTicks(f32 seconds) const noexcept
+    {
+        return static_cast<u64>(std::ceil(std::max(seconds, 0.0f) / m_Resolution));
+    }
+
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Delegate.hpp"
+
+namespace Core {
+
+    enum class TimeDomain : u8
+    {
+        Real,
+        Scaled
+    };
+
+    struct TimerHandle
+    {
+        u32 index = std::numeric_limits<u32>::max();
+        u32 generation = 0;
+
+        [[nodiscard]] constexpr bool IsValid() const noexcept
+        {
+            return index != std::numeric_limits<u32>::max();
+        }
+    };
+
+    // Hierarchical timing wheel (4 levels of 64 slots). Scheduling and
+    // cancelling are O(1); timers that are not due are never touched except
+    // when they cascade down a level. Callbacks run in one batch per Advance.
+    class TimerWheel
+    {
+    public:
+        using Callback = Delegate<void()>;
+
+    public:
+        TimerWheel(f32 resolution = 0.001f);
+        ~TimerWheel() = default;
+
+        TimerWheel(const TimerWheel&) = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+
+        TimerHandle Schedule(f32 delay, Callback callback);
+        TimerHandle ScheduleRepeating(f32 interval, Callback callback);
+        TimerHandle ScheduleRepeating(f32 firstDelay, f32 interval, Callback callback);
+
+        bool Cancel(TimerHandle handle);
+        [[nodiscard]] bool IsPending(TimerHandle handle) const;
+
+        void Advance(f32 deltaTime);
+
+        [[nodiscard]] inline usize GetPendingCount() const noexcept { return m_PendingCount; }
+        [[nodiscard]] inline f64 GetTime() const noexcept { return m_Time; }
+
+    private:
+        static constexpr u32 Levels = 4;
+        static constexpr u32 SlotBits = 6;
+        static constexpr u32 SlotCount = 1u << SlotBits;
+        static constexpr u64 SlotMask = SlotCount - 1;
+
+        static constexpr u32 InvalidIndex = std::numeric_limits<u32>::max();
+        static constexpr u32 OverflowList = Levels * SlotCount;
+        static constexpr u32 NoList = OverflowList + 1;
+
+        struct Node
+        {
+            Callback callback;
+            u64 expiry = 0;
+            u64 interval = 0;
+            u32 generation = 0;
+            u32 list = NoList;
+            u32 prev = InvalidIndex;
+            u32 next = InvalidIndex;
+            bool running = false;   // The callback is moved out while it runs
+        };
+
+        TimerHandle Insert(u64 delayTicks, u64 intervalTicks, Callback&& callback);
+
+        void Link(u32 index);
+        void Unlink(u32 index);
+        void Free(u32 index);
+
+        void Cascade(u32 list);
+        void Expire(u32 list);
+
+        [[nodiscard]] u64 ToTicks(f32 seconds) const noexcept;
+
+    private:
+        f64 m_Resolution;
+        f64 m_Time = 0.0;
+        u64 m_CurrentTick = 0;
+
+        // std::deque keeps nodes in place while callbacks schedule new timers
+        std::deque<Node> m_Nodes;
+        std::vector<u32> m_FreeNodes;
+
+        std::array<u32, Levels * SlotCount + 1> m_Lists;
+        std::array<u64, Levels> m_Occupied {};
+
+        std::vector<u32> m_Expired;
+        usize m_PendingCount = 0;
+    };
+
+}
@@ -5,6 +5,173 @@
 
 namespace Core {
 
+    namespace {
+
+        void AssignTitle(WindowState& state, std::string_view title)
+        {
+            usize length = std::min(title.size(), WindowState::MaxTitleLength);
+
+            // Never split a multi-byte character, continuation bytes are 10xxxxxx
+            if (length < title.size()) {
+                while (length > 0 && (static_cast<u8>(title[length]) & 0xC0) == 0x80) {
+                    --length;
+                }
+            }
+
+            std::memcpy(state.title.data(), title.data(), length);
+            state.title[length] = '\0';
+            state.titleLength = static_cast<u8>(length);
+        }
+
+        i32 ToGlfwCursorMode(CursorMode mode)
+        {
+            switch (mode) {
+                case CursorMode::Hidden: return GLFW_CURSOR_HIDDEN;
+                case CursorMode::Disabled: return GLFW_CURSOR_DISABLED;
+                default: return GLFW_CURSOR_NORMAL;
+            }
+        }
+
+    }
+
+    struct Window::Callbacks
+    {
+        static WindowData& GetData(GLFWwindow* window)
+        {
+            return *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
+        }
+
+        template <IsEvent T, typename... Args>
+        static void Push(GLFWwindow* window, Args&&... args)
+        {
+            WindowData& data = GetData(window);
+
+            // Callbacks for RequiredEvents stay installed when nobody listens
+            if (data.queue && (EventInterest::GetMask() & EventMaskOf<T>) != 0) {
+                data.queue->Push(T(std::forward<Args>(args)...));
+            }
+        }
+
+        static void OnWindowClose(GLFWwindow* window)
+        {
+            Push<WindowClosedEvent>(window);
+        }
+
+        static void OnFramebufferSize(GLFWwindow* window, i32 width, i32 height)
+        {
+            WindowData& data = GetData(window);
+            data.state.width = static_cast<u32>(width);
+            data.state.height = static_cast<u32>(height);
+            data.dirty = true;
+
+            Push<WindowResizedEvent>(window, width, height);
+        }
+
+        static void OnWindowPos(GLFWwindow* window, i32 x, i32 y)
+        {
+            WindowData& data = GetData(window);
+            data.state.x = x;
+            data.state.y = y;
+            data.dirty = true;
+
+            Push<WindowMovedEvent>(window, x, y);
+        }
+
+        static void OnWindowIconify(GLFWwindow* window, i32 iconified)
+        {
+            WindowData& data = GetData(window);
+            data.state.minimized = iconified != 0;
+            data.dirty = true;
+
+            Push<WindowMinimizeEvent>(window, iconified);
+        }
+
+        static void OnWindowFocus(GLFWwindow* window, i32 focused)
+        {
+            WindowData& data = GetData(window);
+            data.state.focused = focused != 0;
+            data.dirty = true;
+
+            Push<WindowFocusEvent>(window, focused);
+        }
+
+        static void OnKey(GLFWwindow* window, i32 key, i32, i32 action, i32)
+        {
+            switch (action) {
+                case GLFW_PRESS: {
+                    Push<KeyPressedEvent>(window, static_cast<KeyCode>(key), false);
+                } break;
+                case GLFW_RELEASE: {
+                    Push<KeyReleasedEvent>(window, static_cast<KeyCode>(key));
+                } break;
+                case GLFW_REPEAT: {
+                    Push<KeyPressedEvent>(window, static_cast<KeyCode>(key), true);
+                } break;
+                default:
+                    LOG_WARN("Unknown key action {}", action);
+            }
+        }
+
+        static void OnChar(GLFWwindow* window, u32 codepoint)
+        {
+            Push<KeyTypedEvent>(window, codepoint);
+        }
+
+        static void OnMouseButton(GLFWwindow* window, i32 button, i32 action, i32)
+        {
+            switch (action) {
+                case GLFW_PRESS: {
+                    Push<MouseButtonPressedEvent>(window, static_cast<MouseButton>(button));
+                } break;
+                case GLFW_RELEASE: {
+                    Push<MouseButtonReleasedEvent>(window, static_cast<MouseButton>(button));
+                } break;
+                default:
+                    LOG_WARN("Unknown mouse button action {}", action);
+            }
+        }
+
+        static void OnCursorPos(GLFWwindow* window, f64 x, f64 y)
+        {
+            Push<MouseMovedEvent>(window, static_cast<f32>(x), static_cast<f32>(y));
+        }
+
+        static void OnScroll(GLFWwindow* window, f64 x, f64 y)
+        {
+            Push<MouseScrolledEvent>(window, static_cast<f32>(x), static_cast<f32>(y));
+        }
+
+        // Installs or removes each GLFW callback whose events changed between the two masks
+        static void Apply(GLFWwindow* window, EventMask installed, EventMask wanted)
+        {
+            struct Binding
+            {
+                EventMask events;
+                void (*set)(GLFWwindow* window, bool enabled);
+            };
+
+            static constexpr Binding Bindings[] = {
+                { EventMaskOf<WindowClosedEvent>, [](GLFWwindow* w, bool on) { glfwSetWindowCloseCallback(w, on ? OnWindowClose : nullptr); } },
+                { EventMaskOf<WindowResizedEvent>, [](GLFWwindow* w, bool on) { glfwSetFramebufferSizeCallback(w, on ? OnFramebufferSize : nullptr); } },
+                { EventMaskOf<WindowMovedEvent>, [](GLFWwindow* w, bool on) { glfwSetWindowPosCallback(w, on ? OnWindowPos : nullptr); } },
+                { EventMaskOf<WindowMinimizeEvent>, [](GLFWwindow* w, bool on) { glfwSetWindowIconifyCallback(w, on ? OnWindowIconify : nullptr); } },
+                { EventMaskOf<WindowFocusEvent>, [](GLFWwindow* w, bool on) { glfwSetWindowFocusCallback(w, on ? OnWindowFocus : nullptr); } },
+                { EventMaskOf<KeyPressedEvent, KeyReleasedEvent>, [](GLFWwindow* w, bool on) { glfwSetKeyCallback(w, on ? OnKey : nullptr); } },
+                { EventMaskOf<KeyTypedEvent>, [](GLFWwindow* w, bool on) { glfwSetCharCallback(w, on ? OnChar : nullptr); } },
+                { EventMaskOf<MouseButtonPressedEvent, MouseButtonReleasedEvent>, [](GLFWwindow* w, bool on) { glfwSetMouseButtonCallback(w, on ? OnMouseButton : nullptr); } },
+                { EventMaskOf<MouseMovedEvent>, [](GLFWwindow* w, bool on) { glfwSetCursorPosCallback(w, on ? OnCursorPos : nullptr); } },
+                { EventMaskOf<MouseScrolledEvent>, [](GLFWwindow* w, bool on) { glfwSetScrollCallback(w, on ? OnScroll : nullptr); } }
+            };
+
+            for (const Binding& binding : Bindings) {
+                const bool enabled = (wanted & binding.events) != 0;
+                if (enabled != ((installed & binding.events) != 0)) {
+                    binding.set(window, enabled);
+                }
+            }
+        }
+    };
+
     Window::Window(const Config& config)
     {
         if (s_InstanceCount.fetch_add(1, std::memory_order_relaxed) == 0) {
@@ -26,141 +193,148 @@ namespace Core {
         {
             i32 w, h;
             glfwGetFramebufferSize(m_Window, &w, &h);
-            m_Data.width = static_cast<u32>(w);
-            m_Data.height = static_cast<u32>(h);
+            m_Data.state.width = static_cast<u32>(w);
+            m_Data.state.height = static_cast<u32>(h);
+
+            glfwGetWindowPos(m_Window, &m_Data.state.x, &m_Data.state.y);
+            m_Data.state.focused = glfwGetWindowAttrib(m_Window, GLFW_FOCUSED) != 0;
+            m_Data.state.minimized = glfwGetWindowAttrib(m_Window, GLFW_ICONIFIED) != 0;
+            AssignTitle(m_Data.state, config.title);
+
+            m_Data.dirty = true;
+            PublishState();
         }
 
-        glfwSetWindowUserPointer(m_Window, &m_Data);
+        s_Windows.push_back(this);
 
-        glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* window) {
-            WindowData& data = *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
-            if (data.queue) {
-                data.queue->Push(WindowClosedEvent());
-            }
-        });
+        glfwSetWindowUserPointer(m_Window, &m_Data);
 
-        glfwSetFramebufferSizeCallback(m_Window, [](GLFWwindow* window, i32 width, i32 height) {
-            WindowData& data = *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
-            data.width = static_cast<u32>(width);
-            data.height = static_cast<u32>(height);
+        glfwSetDropCallback(m_Window, [](GLFWwindow* window, i32 count, const char** paths) {
+            WindowData& data = Callbacks::GetData(window);
 
-            if (data.queue) {
-                data.queue->Push(WindowResizedEvent(width, height));
+            if (data.channel) {
+                data.channel->Push(FileDropEvent(std::vector<std::filesystem::path>(paths, paths + count)));
             }
         });
 
-        glfwSetWindowPosCallback(m_Window, [](GLFWwindow* window, i32 x, i32 y) {
-            WindowData& data = *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
-
-            if (data.queue) {
-                data.queue->Push(WindowMovedEvent(x, y));
-            }
+        // Every other callback is installed only while someone is interested in its events
+        m_InterestHandle = EventInterest::Subscribe([this](EventMask mask) {
+            ApplyInterest(mask);
         });
 
-        glfwSetWindowIconifyCallback(m_Window, [](GLFWwindow* window, i32 iconified) {
-            WindowData& data = *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
+        LOG_INFO("Created Window \"{}\" ({}, {})", m_Data.state.GetTitle(), m_Data.state.width, m_Data.state.height);
+    }
 
-            if (data.queue) {
-                data.queue->Push(WindowMinimizeEvent(iconified));
-            }
-        });
+    Window::~Window()
+    {
+        EventInterest::Unsubscribe(m_InterestHandle);
+        std::erase(s_Windows, this);
 
-        glfwSetWindowFocusCallback(m_Window, [](GLFWwindow* window, i32 focused) {
-            WindowData& data = *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
+        glfwDestroyWindow(m_Window);
+        if (s_InstanceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            glfwTerminate();
+        }
+    }
 
-            if (data.queue) {
-                data.queue->Push(WindowFocusEvent(focused));
-            }
-        });
+    void Window::Resize(u32 width, u32 height)
+    {
+        Enqueue(ResizeCommand { width, height });
+    }
 
-        glfwSetKeyCallback(m_Window, [](GLFWwindow* window, i32 key, i32, i32 action, i32) {
-            WindowData& data = *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
-
-            if (data.queue) {
-                switch (action) {
-                    case GLFW_PRESS: {
-                        data.queue->Push(KeyPressedEvent(static_cast<KeyCode>(key), false));
-                    } break;
-                    case GLFW_RELEASE: {
-                        data.queue->Push(KeyReleasedEvent(static_cast<KeyCode>(key)));
-                    } break;
-                    case GLFW_REPEAT: {
-                        data.queue->Push(KeyPressedEvent(static_cast<KeyCode>(key), true));
-                    } break;
-                    default:
-                        LOG_WARN("Unknown key action {}", action);
-                }
-            }
-        });
+    void Window::SetTitle(std::string_view title)
+    {
+        Enqueue(TitleCommand { std::string(title) });
+    }
 
-        glfwSetCharCallback(m_Window, [](GLFWwindow* window, u32 codepoint) {
-            WindowData& data = *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
+    void Window::SetCursorMode(CursorMode mode)
+    {
+        Enqueue(CursorModeCommand { mode });
+    }
 
-            if (data.queue) {
-                data.queue->Push(KeyTypedEvent(codepoint));
-            }
-        });
+    void Window::Close()
+    {
+        Enqueue(CloseCommand {});
+    }
 
-        glfwSetMouseButtonCallback(m_Window, [](GLFWwindow* window, i32 button, i32 action, i32) {
-            WindowData& data = *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
-
-            if (data.queue) {
-                switch (action) {
-                    case GLFW_PRESS: {
-                        data.queue->Push(MouseButtonPressedEvent(static_cast<MouseButton>(button)));
-                    } break;
-                    case GLFW_RELEASE: {
-                        data.queue->Push(MouseButtonReleasedEvent(static_cast<MouseButton>(button)));
-                    } break;
-                    default:
-                        LOG_WARN("Unknown mouse button action {}", action);
-                }
-            }
-        });
+    std::vector<const char*> Window::GetRequiredVulkanExtensions()
+    {
+        u32 count = 0;
+        const char** extensions = glfwGetRequiredInstanceExtensions(&count);
 
-        glfwSetCursorPosCallback(m_Window, [](GLFWwindow* window, f64 x, f64 y) {
-            WindowData& data = *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
+        return std::vector<const char*>(extensions, extensions + count);
+    }
 
-            if (data.queue) {
-                data.queue->Push(MouseMovedEvent(x, y));
-            }
-        });
+    void Window::ApplyInterest(EventMask mask)
+    {
+        const EventMask wanted = mask | RequiredEvents;
 
-        glfwSetScrollCallback(m_Window, [](GLFWwindow* window, f64 x, f64 y) {
-            WindowData& data = *reinterpret_cast<WindowData*>(glfwGetWindowUserPointer(window));
+        Callbacks::Apply(m_Window, m_InstalledEvents, wanted);
 
-            if (data.queue) {
-                data.queue->Push(MouseScrolledEvent(x, y));
-            }
-        });
+        if (wanted != m_InstalledEvents) {
+            LOG_DEBUG("Window \"{}\" event callbacks: {:#x} -> {:#x}", m_Data.state.GetTitle(), m_InstalledEvents, wanted);
+        }
 
-        LOG_INFO("Created Window \"{}\" ({}, {})", GetTitle(), m_Data.width, m_Data.height);
+        m_InstalledEvents = wanted;
     }
 
-    Window::~Window()
+    void Window::Enqueue(Command&& command)
     {
-        glfwDestroyWindow(m_Window);
-        if (s_InstanceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-            glfwTerminate();
-        }
+        std::scoped_lock lock(m_CommandMutex);
+        m_PendingCommands.push_back(std::move(command));
     }
 
-    std::string Window::GetTitle() const
+    void Window::ApplyCommands()
     {
-        return std::string(glfwGetWindowTitle(m_Window));
+        {
+            std::scoped_lock lock(m_CommandMutex);
+            std::swap(m_PendingCommands, m_DrainingCommands);
+        }
+
+        for (Command& command : m_DrainingCommands) {
+            std::visit([this](auto& c) {
+                using T = std::remove_cvref_t<decltype(c)>;
+
+                if constexpr (std::is_same_v<T, ResizeCommand>) {
+                    glfwSetWindowSize(m_Window, static_cast<i32>(c.width), static_cast<i32>(c.height));
+                } else if constexpr (std::is_same_v<T, TitleCommand>) {
+                    glfwSetWindowTitle(m_Window, c.title.c_str());
+                    AssignTitle(m_Data.state, c.title);
+                    m_Data.dirty = true;
+                } else if constexpr (std::is_same_v<T, CursorModeCommand>) {
+                    glfwSetInputMode(m_Window, GLFW_CURSOR, ToGlfwCursorMode(c.mode));
+                    m_Data.state.cursorMode = c.mode;
+                    m_Data.dirty = true;
+                } else if constexpr (std::is_same_v<T, CloseCommand>) {
+                    glfwSetWindowShouldClose(m_Window, GLFW_TRUE);
+                    Callbacks::Push<WindowClosedEvent>(m_Window);
+                }
+            }, command);
+        }
+
+        m_DrainingCommands.clear();
     }
 
-    std::vector<const char*> Window::GetRequiredVulkanExtensions()
+    void Window::PublishState()
     {
-        u32 count = 0;
-        const char** extensions = glfwGetRequiredInstanceExtensions(&count);
+        if (!m_Data.dirty) return;
 
-        return std::vector<const char*>(extensions, extensions + count);
+        m_Data.state.version++;
+        m_Snapshots.Publish(m_Data.state);
+        m_Data.dirty = false;
     }
 
     void Window::PollEvents()
     {
+        // Commands go first so the callbacks they cause land in this poll where GLFW delivers them synchronously
+        for (Window* window : s_Windows) {
+            window->ApplyCommands();
+        }
+
         glfwPollEvents();
+
+        for (Window* window : s_Windows) {
+            window->PublishState();
+        }
     }
 
 }
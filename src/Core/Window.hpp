@@ -1,11 +1,47 @@
 #pragma once
 
 #include "Core/Events/CoreEvents.hpp"
+#include "Core/Events/EventChannel.hpp"
+#include "Core/Events/EventInterest.hpp"
+#include "Core/SnapshotBuffer.hpp"
 
 struct GLFWwindow;
 
 namespace Core {
 
+    enum class CursorMode : u8
+    {
+        Normal,
+        Hidden,
+        Disabled
+    };
+
+    // Window state as of the end of a PollEvents, readable on any thread
+    struct WindowState
+    {
+        static constexpr usize MaxTitleLength = 127;
+
+        u64 version = 0;        // Bumped every time a change is published
+
+        u32 width = 0;          // Framebuffer size in pixels
+        u32 height = 0;
+        i32 x = 0;
+        i32 y = 0;
+
+        bool focused = false;
+        bool minimized = false;
+        CursorMode cursorMode = CursorMode::Normal;
+
+        // Truncated to MaxTitleLength bytes on a UTF-8 boundary
+        u8 titleLength = 0;
+        std::array<char, MaxTitleLength + 1> title {};
+
+        [[nodiscard]] inline std::string_view GetTitle() const noexcept
+        {
+            return std::string_view(title.data(), titleLength);
+        }
+    };
+
     class Window
     {
         friend class Application;
@@ -24,17 +60,30 @@ namespace Core {
         Window(const Config& config = Config());
         ~Window();
 
-        inline u32 GetWidth() const { return m_Data.width; }
-        inline u32 GetHeight() const { return m_Data.height; }
+        // Safe on any thread, lock-free
+        [[nodiscard]] inline WindowState GetState() const noexcept { return m_Snapshots.Read(); }
+        [[nodiscard]] inline u32 GetWidth() const noexcept { return GetState().width; }
+        [[nodiscard]] inline u32 GetHeight() const noexcept { return GetState().height; }
+
         inline GLFWwindow* GetNative() const { return m_Window; }
 
-        std::string GetTitle() const;
+        // Safe on any thread. Queued and applied together by the next PollEvents;
+        // the published state follows once GLFW reports the change.
+        void Resize(u32 width, u32 height); // In screen coordinates, which may differ from the framebuffer size
+        void SetTitle(std::string_view title);
+        void SetCursorMode(CursorMode mode);
+        void Close();                       // Like the user closing the window
 
         inline void BindEventQueue(EventQueue<CoreEvents>* queue)
         {
             m_Data.queue = queue;
         }
 
+        inline void BindEventChannel(EventChannel* channel)
+        {
+            m_Data.channel = channel;
+        }
+
         // TODO: Should vulkan specific stuff be here?
         static std::vector<const char*> GetRequiredVulkanExtensions();
 
@@ -42,18 +91,49 @@ namespace Core {
         static void PollEvents();
 
     private:
+        struct Callbacks;
+
+        struct ResizeCommand { u32 width; u32 height; };
+        struct TitleCommand { std::string title; };
+        struct CursorModeCommand { CursorMode mode; };
+        struct CloseCommand {};
+
+        using Command = std::variant<ResizeCommand, TitleCommand, CursorModeCommand, CloseCommand>;
+
+        // The state snapshot is kept up to date even when nobody listens for these events
+        static constexpr EventMask RequiredEvents = EventMaskOf<WindowResizedEvent, WindowMovedEvent, WindowMinimizeEvent, WindowFocusEvent>;
+
+        void ApplyInterest(EventMask mask);
+
+        void Enqueue(Command&& command);
+        void ApplyCommands();
+        void PublishState();
+
+    private:
+        // Main thread only, published to the snapshot buffer when dirty
         struct WindowData
         {
-            u32 width = 0;
-            u32 height = 0;
+            WindowState state;
+            bool dirty = false;
             EventQueue<CoreEvents>* queue = nullptr;
+            EventChannel* channel = nullptr;
         };
 
     private:
         inline static std::atomic<usize> s_InstanceCount = 0;
+        inline static std::vector<Window*> s_Windows;
 
         GLFWwindow* m_Window = nullptr;
         WindowData m_Data;
+        SnapshotBuffer<WindowState> m_Snapshots;
+
+        // Producers append under the lock, PollEvents swaps the buffers and applies unlocked
+        std::mutex m_CommandMutex;
+        std::vector<Command> m_PendingCommands;
+        std::vector<Command> m_DrainingCommands;
+
+        EventMask m_InstalledEvents = 0;
+        ListenerHandle m_InterestHandle;
     };
 
 }
@@ -0,0 +1,110 @@
+#include "WorkerPool.hpp"
+
+#include "Threading.hpp"
+
+namespace Core {
+
+    WorkerPool::WorkerPool(u32 threadCount, std::string_view name)
+    {
+        m_Threads.reserve(threadCount);
+
+        for (u32 i = 0; i < threadCount; ++i) {
+            m_Threads.emplace_back(&WorkerPool::WorkerLoop, this, std::string(name) + " " + std::to_string(i));
+        }
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::scoped_lock lock(m_Mutex);
+            m_Stopping = true;
+        }
+        m_WorkReady.notify_all();
+
+        m_Threads.clear();
+    }
+
+    void WorkerPool::Run(u32 count, void* context, InvokeFn invoke)
+    {
+        if (m_Threads.empty()) {
+            for (u32 i = 0; i < count; ++i) {
+                invoke(context, i);
+            }
+            return;
+        }
+
+        {
+            // A worker that woke late for the previous job may still be about to claim from m_Next;
+            // its claims land past that job's count only while m_Next is not reset underneath it
+            std::unique_lock lock(m_Mutex);
+            m_WorkDone.wait(lock, [this] { return m_Busy == 0; });
+
+            m_Count = count;
+            m_Context = context;
+            m_Invoke = invoke;
+
+            m_Next.store(0, std::memory_order_relaxed);
+            m_Remaining.store(count, std::memory_order_relaxed);
+            ++m_Generation;
+        }
+        m_WorkReady.notify_all();
+
+        Drain(count, context, invoke);
+
+        std::unique_lock lock(m_Mutex);
+        m_WorkDone.wait(lock, [this] {
+            return m_Remaining.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    void WorkerPool::Drain(u32 count, void* context, InvokeFn invoke)
+    {
+        u32 completed = 0;
+
+        for (u32 index = m_Next.fetch_add(1, std::memory_order_relaxed); index < count; index = m_Next.fetch_add(1, std::memory_order_relaxed)) {
+            invoke(context, index);
+            ++completed;
+        }
+
+        if (completed > 0 && m_Remaining.fetch_sub(completed, std::memory_order_acq_rel) == completed) {
+            std::scoped_lock lock(m_Mutex);
+            m_WorkDone.notify_all();
+        }
+    }
+
+    void WorkerPool::WorkerLoop(std::string name)
+    {
+        Threading::Topology::Apply(Threading::ThreadRole::Worker, name);
+
+        u64 seen = 0;
+
+        for (;;) {
+            u32 count;
+            void* context;
+            InvokeFn invoke;
+
+            {
+                std::unique_lock lock(m_Mutex);
+                m_WorkReady.wait(lock, [&] { return m_Stopping || m_Generation != seen; });
+
+                if (m_Stopping) return;
+
+                seen = m_Generation;
+                ++m_Busy;
+
+                count = m_Count;
+                context = m_Context;
+                invoke = m_Invoke;
+            }
+
+            Drain(count, context, invoke);
+
+            {
+                std::scoped_lock lock(m_Mutex);
+                --m_Busy;
+            }
+            m_WorkDone.notify_all();
+        }
+    }
+
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+namespace Core {
+
+    // Fixed set of threads for fork-join work. ParallelFor hands out indices
+    // to the workers and the calling thread, and returns once all are done.
+    class WorkerPool
+    {
+    public:
+        // threadCount extra threads are started, the caller always works too
+        WorkerPool(u32 threadCount, std::string_view name = "Worker");
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        // Including the calling thread
+        [[nodiscard]] inline u32 GetConcurrency() const noexcept
+        {
+            return static_cast<u32>(m_Threads.size()) + 1;
+        }
+
+        template <typename Func>
+            requires std::is_invocable_v<Func&, u32>
+        inline void ParallelFor(u32 count, Func&& func)
+        {
+            if (count == 0) return;
+
+            Run(count, &func, [](void* context, u32 index) {
+                (*static_cast<std::remove_reference_t<Func>*>(context))(index);
+            });
+        }
+
+    private:
+        using InvokeFn = void (*)(void* context, u32 index);
+
+        void Run(u32 count, void* context, InvokeFn invoke);
+        void Drain(u32 count, void* context, InvokeFn invoke);
+        void WorkerLoop(std::string name);
+
+    private:
+        std::vector<std::jthread> m_Threads;
+
+        std::mutex m_Mutex;
+        std::condition_variable m_WorkReady;
+        std::condition_variable m_WorkDone;
+
+        u64 m_Generation = 0;
+        u32 m_Busy = 0;
+        bool m_Stopping = false;
+
+        u32 m_Count = 0;
+        void* m_Context = nullptr;
+        InvokeFn m_Invoke = nullptr;
+
+        alignas(64) std::atomic<u32> m_Next = 0;
+        alignas(64) std::atomic<u32> m_Remaining = 0;
+    };
+
+}
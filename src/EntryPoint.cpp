@@ -4,7 +4,18 @@ int main()
 {
     Core::Logger::Init();
 
-    Core::Application* app = new Core::Application();
+    Core::Application::Config config;
+
+    // Optional per-deployment thread placement, see Threading::Config::Parse for the format
+    if (std::filesystem::exists("threading.cfg")) {
+        if (auto threading = Core::Threading::Config::LoadFromFile("threading.cfg")) {
+            config.threading = std::move(*threading);
+        } else {
+            LOG_ERROR("threading.cfg: {}", threading.error());
+        }
+    }
+
+    Core::Application* app = new Core::Application(config);
     app->Run();
     delete app;
 
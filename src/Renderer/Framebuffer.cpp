@@ -0,0 +1,110 @@
+#include "Framebuffer.hpp"
+
+namespace Renderer {
+
+    namespace {
+
+        constexpr u32 AlignUp(u32 value, u32 alignment) noexcept
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+    }
+
+    Framebuffer::Framebuffer(u32 width, u32 height)
+    {
+        Resize(width, height);
+    }
+
+    void Framebuffer::Resize(u32 width, u32 height)
+    {
+        m_Width = std::max(width, 1u);
+        m_Height = std::max(height, 1u);
+        m_Stride = AlignUp(m_Width, TileSize);
+        m_PaddedHeight = AlignUp(m_Height, TileSize);
+
+        m_Color.assign(static_cast<usize>(m_Stride) * m_PaddedHeight, 0);
+        m_Depth.assign(static_cast<usize>(m_Stride) * m_PaddedHeight, 1.0f);
+    }
+
+    void Framebuffer::ClearTile(u32 tileX, u32 tileY, u32 color, f32 depth) noexcept
+    {
+        const usize offset = static_cast<usize>(tileY) * TileSize * m_Stride + static_cast<usize>(tileX) * TileSize;
+
+        for (u32 row = 0; row < TileSize; ++row) {
+            const usize start = offset + static_cast<usize>(row) * m_Stride;
+            std::fill_n(m_Color.data() + start, TileSize, color);
+            std::fill_n(m_Depth.data() + start, TileSize, depth);
+        }
+    }
+
+    std::expected<void, std::string> Framebuffer::Save(const std::filesystem::path& path) const
+    {
+        const std::string extension = path.extension().string();
+
+        if (extension == ".tga") return SaveTGA(path);
+        if (extension == ".ppm") return SavePPM(path);
+
+        return std::unexpected("Unsupported image format \"" + extension + "\", use .tga or .ppm");
+    }
+
+    std::expected<void, std::string> Framebuffer::SaveTGA(const std::filesystem::path& path) const
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (!file) {
+            return std::unexpected("Failed to open " + path.string());
+        }
+
+        // Uncompressed true-color, 32 bpp, origin at the top left
+        const u8 header[18] = {
+            0, 0, 2,
+            0, 0, 0, 0, 0,
+            0, 0, 0, 0,
+            static_cast<u8>(m_Width & 0xFF), static_cast<u8>(m_Width >> 8),
+            static_cast<u8>(m_Height & 0xFF), static_cast<u8>(m_Height >> 8),
+            32, 0x28
+        };
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+        // Pixels are already BGRA in memory
+        for (u32 y = 0; y < m_Height; ++y) {
+            file.write(reinterpret_cast<const char*>(m_Color.data() + static_cast<usize>(y) * m_Stride), m_Width * sizeof(u32));
+        }
+
+        if (!file) {
+            return std::unexpected("Failed to write " + path.string());
+        }
+
+        return {};
+    }
+
+    std::expected<void, std::string> Framebuffer::SavePPM(const std::filesystem::path& path) const
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (!file) {
+            return std::unexpected("Failed to open " + path.string());
+        }
+
+        file << "P6\n" << m_Width << ' ' << m_Height << "\n255\n";
+
+        std::vector<u8> row(static_cast<usize>(m_Width) * 3);
+        for (u32 y = 0; y < m_Height; ++y) {
+            const u32* pixels = m_Color.data() + static_cast<usize>(y) * m_Stride;
+
+            for (u32 x = 0; x < m_Width; ++x) {
+                row[x * 3 + 0] = static_cast<u8>(pixels[x] >> 16);
+                row[x * 3 + 1] = static_cast<u8>(pixels[x] >> 8);
+                row[x * 3 + 2] = static_cast<u8>(pixels[x]);
+            }
+
+            file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+        }
+
+        if (!file) {
+            return std::unexpected("Failed to write " + path.string());
+        }
+
+        return {};
+    }
+
+}
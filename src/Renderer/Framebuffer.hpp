@@ -0,0 +1,53 @@
+#pragma once
+
+namespace Renderer {
+
+    // 0xAARRGGBB, which is BGRA in memory: the layout of Win32 DIBs and TGA files
+    [[nodiscard]] constexpr u32 PackColor(u8 r, u8 g, u8 b, u8 a = 255) noexcept
+    {
+        return (static_cast<u32>(a) << 24) | (static_cast<u32>(r) << 16) | (static_cast<u32>(g) << 8) | static_cast<u32>(b);
+    }
+
+    // Color and depth planes, row-major. Storage is padded to whole tiles so
+    // SIMD kernels can run full tile rows without edge cases; only the
+    // width x height region is ever presented or saved.
+    class Framebuffer
+    {
+    public:
+        static constexpr u32 TileSize = 64;
+
+    public:
+        Framebuffer(u32 width, u32 height);
+
+        void Resize(u32 width, u32 height);
+
+        [[nodiscard]] inline u32 GetWidth() const noexcept { return m_Width; }
+        [[nodiscard]] inline u32 GetHeight() const noexcept { return m_Height; }
+        [[nodiscard]] inline u32 GetStride() const noexcept { return m_Stride; }
+
+        [[nodiscard]] inline u32 GetTileCountX() const noexcept { return m_Stride / TileSize; }
+        [[nodiscard]] inline u32 GetTileCountY() const noexcept { return m_PaddedHeight / TileSize; }
+
+        [[nodiscard]] inline u32* GetColor() noexcept { return m_Color.data(); }
+        [[nodiscard]] inline const u32* GetColor() const noexcept { return m_Color.data(); }
+        [[nodiscard]] inline f32* GetDepth() noexcept { return m_Depth.data(); }
+        [[nodiscard]] inline const f32* GetDepth() const noexcept { return m_Depth.data(); }
+
+        void ClearTile(u32 tileX, u32 tileY, u32 color, f32 depth) noexcept;
+
+        // Format is picked from the extension, .tga or .ppm
+        std::expected<void, std::string> Save(const std::filesystem::path& path) const;
+        std::expected<void, std::string> SaveTGA(const std::filesystem::path& path) const;
+        std::expected<void, std::string> SavePPM(const std::filesystem::path& path) const;
+
+    private:
+        u32 m_Width = 0;
+        u32 m_Height = 0;
+        u32 m_Stride = 0;
+        u32 m_PaddedHeight = 0;
+
+        std::vector<u32> m_Color;
+        std::vector<f32> m_Depth;
+    };
+
+}
@@ -0,0 +1,56 @@
+#include "Present.hpp"
+
+#include "Core/Window.hpp"
+
+#if defined(_WIN32)
+    #include <windows.h>
+
+    #include <GLFW/glfw3.h>
+    #include <GLFW/glfw3native.h>
+#endif
+
+namespace Renderer {
+
+#if defined(_WIN32)
+    bool Present(const Framebuffer& framebuffer, const Core::Window& window)
+    {
+        HWND hwnd = glfwGetWin32Window(window.GetNative());
+        HDC dc = GetDC(hwnd);
+        if (!dc) return false;
+
+        BITMAPINFO info {};
+        info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+        info.bmiHeader.biWidth = static_cast<LONG>(framebuffer.GetStride());
+        info.bmiHeader.biHeight = -static_cast<LONG>(framebuffer.GetHeight()); // Top-down rows
+        info.bmiHeader.biPlanes = 1;
+        info.bmiHeader.biBitCount = 32;
+        info.bmiHeader.biCompression = BI_RGB;
+
+        const i32 width = static_cast<i32>(framebuffer.GetWidth());
+        const i32 height = static_cast<i32>(framebuffer.GetHeight());
+
+        const i32 lines = SetDIBitsToDevice(
+            dc,
+            0, 0, width, height,
+            0, 0, 0, static_cast<UINT>(height),
+            framebuffer.GetColor(), &info, DIB_RGB_COLORS
+        );
+
+        ReleaseDC(hwnd, dc);
+
+        return lines > 0;
+    }
+#else
+    bool Present(const Framebuffer&, const Core::Window&)
+    {
+        static bool warned = false;
+        if (!warned) {
+            LOG_WARN("Presenting the software framebuffer is only implemented on Win32, frames can still be saved to disk");
+            warned = true;
+        }
+
+        return false;
+    }
+#endif
+
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Framebuffer.hpp"
+
+namespace Core {
+
+    class Window;
+
+}
+
+namespace Renderer {
+
+    // Blits the framebuffer into the window's client area. Only Win32 has a
+    // present path; elsewhere this returns false and frames can only be saved.
+    bool Present(const Framebuffer& framebuffer, const Core::Window& window);
+
+}
@@ -0,0 +1,236 @@
+#include "RasterKernels.hpp"
+
+#include "Core/CPUFeatures.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define RENDERER_HAS_SSE2 1
+#endif
+
+namespace Renderer {
+
+    namespace {
+
+        inline bool IsInside(f32 edge, bool topLeft) noexcept
+        {
+            return edge > 0.0f || (edge == 0.0f && topLeft);
+        }
+
+        inline u32 ToChannel(f32 value) noexcept
+        {
+            return static_cast<u32>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+
+        // Clamps the triangle's bounds to the tile, returns false if nothing is left
+        inline bool ClipBounds(const TileTarget& tile, const TriangleSetup& tri, i32& x0, i32& y0, i32& x1, i32& y1) noexcept
+        {
+            x0 = std::max(tri.minX, tile.minX);
+            y0 = std::max(tri.minY, tile.minY);
+            x1 = std::min(tri.maxX + 1, tile.maxX);
+            y1 = std::min(tri.maxY + 1, tile.maxY);
+
+            return x0 < x1 && y0 < y1;
+        }
+
+    }
+
+    void Kernels::RasterizeScalar(const TileTarget& tile, const TriangleSetup& tri) noexcept
+    {
+        i32 x0, y0, x1, y1;
+        if (!ClipBounds(tile, tri, x0, y0, x1, y1)) return;
+
+        const bool topLeft0 = tri.topLeft & 1;
+        const bool topLeft1 = tri.topLeft & 2;
+        const bool topLeft2 = tri.topLeft & 4;
+
+        // Planes are evaluated as a * x + (b * y + c), in the same order as the SIMD kernels,
+        // so every kernel rounds edge and depth values identically and agrees on coverage
+        const auto row = [](const PlaneEquation& plane, f32 y) { return plane.b * y + plane.c; };
+
+        for (i32 y = y0; y < y1; ++y) {
+            const f32 fy = static_cast<f32>(y);
+            const f32 row0 = row(tri.edges[0], fy), row1 = row(tri.edges[1], fy), row2 = row(tri.edges[2], fy);
+            const f32 rowZ = row(tri.depth, fy), rowW = row(tri.invW, fy);
+            const f32 rowR = row(tri.red, fy), rowG = row(tri.green, fy), rowB = row(tri.blue, fy);
+
+            u32* color = tile.color + static_cast<usize>(y) * tile.stride;
+            f32* depth = tile.depth + static_cast<usize>(y) * tile.stride;
+
+            for (i32 x = x0; x < x1; ++x) {
+                const f32 fx = static_cast<f32>(x);
+
+                const f32 e0 = tri.edges[0].a * fx + row0;
+                const f32 e1 = tri.edges[1].a * fx + row1;
+                const f32 e2 = tri.edges[2].a * fx + row2;
+
+                if (!IsInside(e0, topLeft0) || !IsInside(e1, topLeft1) || !IsInside(e2, topLeft2)) continue;
+
+                const f32 z = tri.depth.a * fx + rowZ;
+                if (!(z < depth[x])) continue;
+
+                const f32 w = 1.0f / (tri.invW.a * fx + rowW);
+                const f32 r = (tri.red.a * fx + rowR) * w;
+                const f32 g = (tri.green.a * fx + rowG) * w;
+                const f32 b = (tri.blue.a * fx + rowB) * w;
+
+                depth[x] = z;
+                color[x] = 0xFF000000u | (ToChannel(r) << 16) | (ToChannel(g) << 8) | ToChannel(b);
+            }
+        }
+    }
+
+#if defined(RENDERER_HAS_SSE2)
+    namespace {
+
+        struct PlaneSSE
+        {
+            __m128 a;
+            __m128 b;
+            __m128 c;
+
+            explicit PlaneSSE(const PlaneEquation& plane) noexcept
+                : a(_mm_set1_ps(plane.a)), b(_mm_set1_ps(plane.b)), c(_mm_set1_ps(plane.c)) {}
+
+            // Row base for y, so each pixel costs one multiply-add
+            inline __m128 Row(__m128 y) const noexcept
+            {
+                return _mm_add_ps(_mm_mul_ps(b, y), c);
+            }
+
+            inline __m128 Eval(__m128 x, __m128 row) const noexcept
+            {
+                return _mm_add_ps(_mm_mul_ps(a, x), row);
+            }
+        };
+
+        inline __m128 InsideMask(__m128 edge, __m128 topLeft) noexcept
+        {
+            const __m128 zero = _mm_setzero_ps();
+            return _mm_or_ps(_mm_cmpgt_ps(edge, zero), _mm_and_ps(_mm_cmpeq_ps(edge, zero), topLeft));
+        }
+
+        inline __m128i ToChannelSSE(__m128 value) noexcept
+        {
+            const __m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+            return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(clamped, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+        }
+
+        inline __m128 TopLeftMask(u32 topLeft, u32 edge) noexcept
+        {
+            return _mm_castsi128_ps(_mm_set1_epi32((topLeft >> edge) & 1 ? -1 : 0));
+        }
+
+    }
+
+    void Kernels::RasterizeSSE2(const TileTarget& tile, const TriangleSetup& tri) noexcept
+    {
+        i32 x0, y0, x1, y1;
+        if (!ClipBounds(tile, tri, x0, y0, x1, y1)) return;
+
+        const PlaneSSE e0(tri.edges[0]), e1(tri.edges[1]), e2(tri.edges[2]);
+        const PlaneSSE z(tri.depth), invW(tri.invW), red(tri.red), green(tri.green), blue(tri.blue);
+
+        const __m128 topLeft0 = TopLeftMask(tri.topLeft, 0);
+        const __m128 topLeft1 = TopLeftMask(tri.topLeft, 1);
+        const __m128 topLeft2 = TopLeftMask(tri.topLeft, 2);
+
+        const __m128 laneOffsets = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+        const __m128i laneIndices = _mm_setr_epi32(0, 1, 2, 3);
+        const __m128i alpha = _mm_set1_epi32(static_cast<i32>(0xFF000000u));
+
+        // Tiles start on multiples of 64, so aligning down stays inside the tile
+        const i32 startX = x0 & ~3;
+        const __m128i first = _mm_set1_epi32(x0 - 1);
+        const __m128i last = _mm_set1_epi32(x1);
+
+        for (i32 y = y0; y < y1; ++y) {
+            const __m128 fy = _mm_set1_ps(static_cast<f32>(y));
+            const __m128 row0 = e0.Row(fy), row1 = e1.Row(fy), row2 = e2.Row(fy);
+            const __m128 rowZ = z.Row(fy), rowW = invW.Row(fy);
+            const __m128 rowR = red.Row(fy), rowG = green.Row(fy), rowB = blue.Row(fy);
+
+            u32* color = tile.color + static_cast<usize>(y) * tile.stride;
+            f32* depth = tile.depth + static_cast<usize>(y) * tile.stride;
+
+            for (i32 x = startX; x < x1; x += 4) {
+                const __m128 fx = _mm_add_ps(_mm_set1_ps(static_cast<f32>(x)), laneOffsets);
+
+                // Lanes outside [x0, x1) belong to other triangles' bounds or lie past the visible edge
+                const __m128i lanes = _mm_add_epi32(_mm_set1_epi32(x), laneIndices);
+                __m128 mask = _mm_castsi128_ps(_mm_and_si128(_mm_cmpgt_epi32(lanes, first), _mm_cmplt_epi32(lanes, last)));
+
+                mask = _mm_and_ps(mask, InsideMask(e0.Eval(fx, row0), topLeft0));
+                mask = _mm_and_ps(mask, InsideMask(e1.Eval(fx, row1), topLeft1));
+                mask = _mm_and_ps(mask, InsideMask(e2.Eval(fx, row2), topLeft2));
+                if (_mm_movemask_ps(mask) == 0) continue;
+
+                const __m128 depthValue = z.Eval(fx, rowZ);
+                const __m128 oldDepth = _mm_loadu_ps(depth + x);
+                mask = _mm_and_ps(mask, _mm_cmplt_ps(depthValue, oldDepth));
+                if (_mm_movemask_ps(mask) == 0) continue;
+
+                const __m128 w = _mm_div_ps(_mm_set1_ps(1.0f), invW.Eval(fx, rowW));
+                const __m128i r = ToChannelSSE(_mm_mul_ps(red.Eval(fx, rowR), w));
+                const __m128i g = ToChannelSSE(_mm_mul_ps(green.Eval(fx, rowG), w));
+                const __m128i b = ToChannelSSE(_mm_mul_ps(blue.Eval(fx, rowB), w));
+
+                const __m128i packed = _mm_or_si128(_mm_or_si128(alpha, _mm_slli_epi32(r, 16)), _mm_or_si128(_mm_slli_epi32(g, 8), b));
+
+                const __m128i maskBits = _mm_castps_si128(mask);
+                const __m128i oldColor = _mm_loadu_si128(reinterpret_cast<const __m128i*>(color + x));
+
+                _mm_storeu_ps(depth + x, _mm_or_ps(_mm_and_ps(mask, depthValue), _mm_andnot_ps(mask, oldDepth)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(color + x),
+                    _mm_or_si128(_mm_and_si128(maskBits, packed), _mm_andnot_si128(maskBits, oldColor)));
+            }
+        }
+    }
+#else
+    void Kernels::RasterizeSSE2(const TileTarget& tile, const TriangleSetup& tri) noexcept
+    {
+        RasterizeScalar(tile, tri);
+    }
+#endif
+
+    RasterizeFn GetRasterizeFn(RasterKernel kernel) noexcept
+    {
+        switch (kernel) {
+            case RasterKernel::AVX2: return &Kernels::RasterizeAVX2;
+            case RasterKernel::SSE2: return &Kernels::RasterizeSSE2;
+            default: return &Kernels::RasterizeScalar;
+        }
+    }
+
+    std::string_view GetKernelName(RasterKernel kernel) noexcept
+    {
+        switch (kernel) {
+            case RasterKernel::AVX2: return "avx2";
+            case RasterKernel::SSE2: return "sse2";
+            default: return "scalar";
+        }
+    }
+
+    bool IsKernelSupported(RasterKernel kernel) noexcept
+    {
+        const Core::CPUFeatures& features = Core::CPUFeatures::Get();
+
+        switch (kernel) {
+#if defined(RENDERER_HAS_SSE2)
+            case RasterKernel::AVX2: return features.avx2 && features.fma;
+            case RasterKernel::SSE2: return features.sse2;
+#else
+            case RasterKernel::AVX2:
+            case RasterKernel::SSE2: return false;
+#endif
+            default: return true;
+        }
+    }
+
+    RasterKernel GetBestKernel() noexcept
+    {
+        if (IsKernelSupported(RasterKernel::AVX2)) return RasterKernel::AVX2;
+        if (IsKernelSupported(RasterKernel::SSE2)) return RasterKernel::SSE2;
+        return RasterKernel::Scalar;
+    }
+
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+// RasterKernelsAVX2.cpp is compiled with AVX2 flags and without the
+// precompiled header, so this header includes what it uses itself.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Types.hpp"
+
+namespace Renderer {
+
+    // v(x, y) = a * x + b * y + c, evaluated at integer pixel coordinates. The
+    // half-pixel offset to the pixel center is already folded into c.
+    struct PlaneEquation
+    {
+        f32 a;
+        f32 b;
+        f32 c;
+    };
+
+    struct TriangleSetup
+    {
+        // Edge functions, positive inside. Pixels exactly on an edge belong to
+        // the triangle only when the edge is a top or left edge (bit i of topLeft).
+        std::array<PlaneEquation, 3> edges;
+        u32 topLeft;
+
+        PlaneEquation depth;
+        PlaneEquation invW;
+        PlaneEquation red;
+        PlaneEquation green;
+        PlaneEquation blue;
+
+        // Inclusive pixel bounds, clamped to the framebuffer
+        i32 minX;
+        i32 minY;
+        i32 maxX;
+        i32 maxY;
+    };
+
+    // One tile of the framebuffer. max is exclusive and clamped to the visible area.
+    struct TileTarget
+    {
+        u32* color;
+        f32* depth;
+        u32 stride;
+
+        i32 minX;
+        i32 minY;
+        i32 maxX;
+        i32 maxY;
+    };
+
+    enum class RasterKernel : u8
+    {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    using RasterizeFn = void (*)(const TileTarget& tile, const TriangleSetup& triangle) noexcept;
+
+    namespace Kernels {
+
+        // Depth test is less-than, passing pixels write depth and perspective-correct color
+        void RasterizeScalar(const TileTarget& tile, const TriangleSetup& triangle) noexcept;
+        void RasterizeSSE2(const TileTarget& tile, const TriangleSetup& triangle) noexcept;
+        void RasterizeAVX2(const TileTarget& tile, const TriangleSetup& triangle) noexcept;
+
+    }
+
+    [[nodiscard]] RasterizeFn GetRasterizeFn(RasterKernel kernel) noexcept;
+    [[nodiscard]] std::string_view GetKernelName(RasterKernel kernel) noexcept;
+
+    // Widest kernel the CPU supports
+    [[nodiscard]] RasterKernel GetBestKernel() noexcept;
+    [[nodiscard]] bool IsKernelSupported(RasterKernel kernel) noexcept;
+
+}
@@ -0,0 +1,136 @@
+// Built with -mavx2 -mfma (/arch:AVX2 on MSVC) and without the precompiled
+// header, see CMakeLists.txt. Only called after GetBestKernel checked the CPU.
+
+#include "RasterKernels.hpp"
+
+#include <algorithm>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+namespace Renderer {
+
+#if defined(__AVX2__)
+    namespace {
+
+        struct PlaneAVX
+        {
+            __m256 a;
+            __m256 b;
+            __m256 c;
+
+            explicit PlaneAVX(const PlaneEquation& plane) noexcept
+                : a(_mm256_set1_ps(plane.a)), b(_mm256_set1_ps(plane.b)), c(_mm256_set1_ps(plane.c)) {}
+
+            inline __m256 Row(__m256 y) const noexcept
+            {
+                return _mm256_fmadd_ps(b, y, c);
+            }
+
+            inline __m256 Eval(__m256 x, __m256 row) const noexcept
+            {
+                return _mm256_fmadd_ps(a, x, row);
+            }
+
+            // Separately rounded like the scalar and SSE2 kernels, for the values that decide coverage
+            inline __m256 RowUnfused(__m256 y) const noexcept
+            {
+                return _mm256_add_ps(_mm256_mul_ps(b, y), c);
+            }
+
+            inline __m256 EvalUnfused(__m256 x, __m256 row) const noexcept
+            {
+                return _mm256_add_ps(_mm256_mul_ps(a, x), row);
+            }
+        };
+
+        inline __m256 InsideMask(__m256 edge, __m256 topLeft) noexcept
+        {
+            const __m256 zero = _mm256_setzero_ps();
+            return _mm256_or_ps(_mm256_cmp_ps(edge, zero, _CMP_GT_OQ), _mm256_and_ps(_mm256_cmp_ps(edge, zero, _CMP_EQ_OQ), topLeft));
+        }
+
+        inline __m256i ToChannel(__m256 value) noexcept
+        {
+            const __m256 clamped = _mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+            return _mm256_cvttps_epi32(_mm256_fmadd_ps(clamped, _mm256_set1_ps(255.0f), _mm256_set1_ps(0.5f)));
+        }
+
+        inline __m256 TopLeftMask(u32 topLeft, u32 edge) noexcept
+        {
+            return _mm256_castsi256_ps(_mm256_set1_epi32((topLeft >> edge) & 1 ? -1 : 0));
+        }
+
+    }
+
+    void Kernels::RasterizeAVX2(const TileTarget& tile, const TriangleSetup& tri) noexcept
+    {
+        const i32 x0 = std::max(tri.minX, tile.minX);
+        const i32 y0 = std::max(tri.minY, tile.minY);
+        const i32 x1 = std::min(tri.maxX + 1, tile.maxX);
+        const i32 y1 = std::min(tri.maxY + 1, tile.maxY);
+        if (x0 >= x1 || y0 >= y1) return;
+
+        const PlaneAVX e0(tri.edges[0]), e1(tri.edges[1]), e2(tri.edges[2]);
+        const PlaneAVX z(tri.depth), invW(tri.invW), red(tri.red), green(tri.green), blue(tri.blue);
+
+        const __m256 topLeft0 = TopLeftMask(tri.topLeft, 0);
+        const __m256 topLeft1 = TopLeftMask(tri.topLeft, 1);
+        const __m256 topLeft2 = TopLeftMask(tri.topLeft, 2);
+
+        const __m256 laneOffsets = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+        const __m256i laneIndices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i alpha = _mm256_set1_epi32(static_cast<i32>(0xFF000000u));
+
+        const i32 startX = x0 & ~7;
+        const __m256i first = _mm256_set1_epi32(x0 - 1);
+        const __m256i last = _mm256_set1_epi32(x1);
+
+        for (i32 y = y0; y < y1; ++y) {
+            const __m256 fy = _mm256_set1_ps(static_cast<f32>(y));
+            const __m256 row0 = e0.RowUnfused(fy), row1 = e1.RowUnfused(fy), row2 = e2.RowUnfused(fy);
+            const __m256 rowZ = z.RowUnfused(fy), rowW = invW.Row(fy);
+            const __m256 rowR = red.Row(fy), rowG = green.Row(fy), rowB = blue.Row(fy);
+
+            u32* color = tile.color + static_cast<usize>(y) * tile.stride;
+            f32* depth = tile.depth + static_cast<usize>(y) * tile.stride;
+
+            for (i32 x = startX; x < x1; x += 8) {
+                const __m256 fx = _mm256_add_ps(_mm256_set1_ps(static_cast<f32>(x)), laneOffsets);
+
+                const __m256i lanes = _mm256_add_epi32(_mm256_set1_epi32(x), laneIndices);
+                __m256 mask = _mm256_castsi256_ps(_mm256_and_si256(_mm256_cmpgt_epi32(lanes, first), _mm256_cmpgt_epi32(last, lanes)));
+
+                mask = _mm256_and_ps(mask, InsideMask(e0.EvalUnfused(fx, row0), topLeft0));
+                mask = _mm256_and_ps(mask, InsideMask(e1.EvalUnfused(fx, row1), topLeft1));
+                mask = _mm256_and_ps(mask, InsideMask(e2.EvalUnfused(fx, row2), topLeft2));
+                if (_mm256_movemask_ps(mask) == 0) continue;
+
+                const __m256 depthValue = z.EvalUnfused(fx, rowZ);
+                const __m256 oldDepth = _mm256_loadu_ps(depth + x);
+                mask = _mm256_and_ps(mask, _mm256_cmp_ps(depthValue, oldDepth, _CMP_LT_OQ));
+                if (_mm256_movemask_ps(mask) == 0) continue;
+
+                const __m256 w = _mm256_div_ps(_mm256_set1_ps(1.0f), invW.Eval(fx, rowW));
+                const __m256i r = ToChannel(_mm256_mul_ps(red.Eval(fx, rowR), w));
+                const __m256i g = ToChannel(_mm256_mul_ps(green.Eval(fx, rowG), w));
+                const __m256i b = ToChannel(_mm256_mul_ps(blue.Eval(fx, rowB), w));
+
+                const __m256i packed = _mm256_or_si256(_mm256_or_si256(alpha, _mm256_slli_epi32(r, 16)), _mm256_or_si256(_mm256_slli_epi32(g, 8), b));
+                const __m256i oldColor = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(color + x));
+
+                _mm256_storeu_ps(depth + x, _mm256_blendv_ps(oldDepth, depthValue, mask));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(color + x),
+                    _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(oldColor), _mm256_castsi256_ps(packed), mask)));
+            }
+        }
+    }
+#else
+    void Kernels::RasterizeAVX2(const TileTarget& tile, const TriangleSetup& tri) noexcept
+    {
+        RasterizeScalar(tile, tri);
+    }
+#endif
+
+}
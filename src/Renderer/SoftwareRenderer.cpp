@@ -0,0 +1,264 @@
+#include "SoftwareRenderer.hpp"
+
+namespace Renderer {
+
+    namespace {
+
+        // Beyond this the f32 edge functions lose too much precision; such triangles are dropped
+        constexpr f32 GuardBand = 16384.0f;
+
+        constexpr f32 NearW = 1e-5f;
+
+        f32 ElapsedMs(std::chrono::steady_clock::time_point start)
+        {
+            return std::chrono::duration<f32, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        // Attribute plane from per-vertex values. Gradients are taken relative to
+        // the first vertex so sliver triangles keep their precision.
+        PlaneEquation MakePlane(const std::array<f32, 3>& x, const std::array<f32, 3>& y, f32 invArea, f32 v0, f32 v1, f32 v2) noexcept
+        {
+            const f32 dx1 = x[1] - x[0], dy1 = y[1] - y[0];
+            const f32 dx2 = x[2] - x[0], dy2 = y[2] - y[0];
+            const f32 dv1 = v1 - v0, dv2 = v2 - v0;
+
+            const f32 a = (dv1 * dy2 - dv2 * dy1) * invArea;
+            const f32 b = (dv2 * dx1 - dv1 * dx2) * invArea;
+
+            return PlaneEquation { a, b, v0 - a * x[0] - b * y[0] };
+        }
+
+        void ShiftToPixelCenter(PlaneEquation& plane) noexcept
+        {
+            plane.c += 0.5f * (plane.a + plane.b);
+        }
+
+    }
+
+    SoftwareRenderer::SoftwareRenderer(const Config& config)
+        : m_Framebuffer(config.width, config.height),
+          m_Workers(config.threads, "Raster"),
+          m_CullBackFaces(config.cullBackFaces)
+    {
+        SetKernel(config.kernel.value_or(GetBestKernel()));
+        m_Bins.resize(static_cast<usize>(m_Framebuffer.GetTileCountX()) * m_Framebuffer.GetTileCountY());
+
+        LOG_INFO("Software renderer: {}x{}, {} threads, {} kernel",
+            m_Framebuffer.GetWidth(), m_Framebuffer.GetHeight(), m_Workers.GetConcurrency(), GetKernelName(m_Kernel));
+    }
+
+    void SoftwareRenderer::Resize(u32 width, u32 height)
+    {
+        m_Framebuffer.Resize(width, height);
+        m_Bins.resize(static_cast<usize>(m_Framebuffer.GetTileCountX()) * m_Framebuffer.GetTileCountY());
+    }
+
+    void SoftwareRenderer::SetKernel(RasterKernel kernel)
+    {
+        if (!IsKernelSupported(kernel)) {
+            LOG_WARN("Raster kernel {} is not supported on this CPU, using {}", GetKernelName(kernel), GetKernelName(GetBestKernel()));
+            kernel = GetBestKernel();
+        }
+
+        m_Kernel = kernel;
+        m_Rasterize = GetRasterizeFn(kernel);
+    }
+
+    void SoftwareRenderer::BeginFrame(u32 clearColor, f32 clearDepth)
+    {
+        m_ClearColor = clearColor;
+        m_ClearDepth = clearDepth;
+
+        m_Vertices.clear();
+        m_Indices.clear();
+        m_Stats = RasterStats {};
+    }
+
+    void SoftwareRenderer::Submit(std::span<const Vertex> vertices, std::span<const u32> indices)
+    {
+        const u32 base = static_cast<u32>(m_Vertices.size());
+
+        m_Vertices.insert(m_Vertices.end(), vertices.begin(), vertices.end());
+
+        const usize count = indices.size() - indices.size() % 3;
+        m_Indices.reserve(m_Indices.size() + count);
+        for (usize i = 0; i < count; ++i) {
+            assert(indices[i] < vertices.size() && "Index out of range");
+            m_Indices.push_back(base + indices[i]);
+        }
+    }
+
+    void SoftwareRenderer::EndFrame()
+    {
+        const auto setupStart = std::chrono::steady_clock::now();
+
+        const u32 triangleCount = static_cast<u32>(m_Indices.size() / 3);
+        m_Setups.resize(triangleCount);
+        m_Visible.resize(triangleCount);
+
+        m_Workers.ParallelFor((triangleCount + SetupBatchSize - 1) / SetupBatchSize, [&](u32 batch) {
+            const u32 begin = batch * SetupBatchSize;
+            const u32 end = std::min(begin + SetupBatchSize, triangleCount);
+
+            for (u32 i = begin; i < end; ++i) {
+                const u32* index = m_Indices.data() + static_cast<usize>(i) * 3;
+                m_Visible[i] = SetupTriangle(m_Vertices[index[0]], m_Vertices[index[1]], m_Vertices[index[2]], m_Setups[i]);
+            }
+        });
+
+        // Serial so every bin lists triangles in submission order, which keeps equal-depth results stable
+        Bin();
+
+        m_Stats.submitted = triangleCount;
+        m_Stats.setupMs = ElapsedMs(setupStart);
+
+        const auto rasterStart = std::chrono::steady_clock::now();
+
+        m_Workers.ParallelFor(static_cast<u32>(m_Bins.size()), [this](u32 tile) {
+            RasterizeTile(tile);
+        });
+
+        m_Stats.rasterMs = ElapsedMs(rasterStart);
+    }
+
+    bool SoftwareRenderer::SetupTriangle(const Vertex& v0, const Vertex& v1, const Vertex& v2, TriangleSetup& setup) const noexcept
+    {
+        // No near-plane clipping: triangles reaching behind the camera are dropped
+        if (v0.w < NearW || v1.w < NearW || v2.w < NearW) return false;
+
+        const f32 width = static_cast<f32>(m_Framebuffer.GetWidth());
+        const f32 height = static_cast<f32>(m_Framebuffer.GetHeight());
+
+        const std::array<const Vertex*, 3> vertices { &v0, &v1, &v2 };
+        std::array<f32, 3> sx, sy, sz, invW;
+
+        for (usize i = 0; i < 3; ++i) {
+            invW[i] = 1.0f / vertices[i]->w;
+            sx[i] = (vertices[i]->x * invW[i] * 0.5f + 0.5f) * width;
+            sy[i] = (0.5f - vertices[i]->y * invW[i] * 0.5f) * height;
+            sz[i] = vertices[i]->z * invW[i];
+
+            if (std::abs(sx[i]) > GuardBand || std::abs(sy[i]) > GuardBand) return false;
+        }
+
+        const f32 minX = std::min({ sx[0], sx[1], sx[2] });
+        const f32 maxX = std::max({ sx[0], sx[1], sx[2] });
+        const f32 minY = std::min({ sy[0], sy[1], sy[2] });
+        const f32 maxY = std::max({ sy[0], sy[1], sy[2] });
+
+        // Pixel centers covered by the bounds, clamped to the visible area
+        setup.minX = std::max(static_cast<i32>(std::ceil(minX - 0.5f)), 0);
+        setup.minY = std::max(static_cast<i32>(std::ceil(minY - 0.5f)), 0);
+        setup.maxX = std::min(static_cast<i32>(std::floor(maxX - 0.5f)), static_cast<i32>(m_Framebuffer.GetWidth()) - 1);
+        setup.maxY = std::min(static_cast<i32>(std::floor(maxY - 0.5f)), static_cast<i32>(m_Framebuffer.GetHeight()) - 1);
+
+        if (setup.minX > setup.maxX || setup.minY > setup.maxY) return false;
+
+        // Edge i is opposite vertex i
+        for (usize i = 0; i < 3; ++i) {
+            const usize a = (i + 1) % 3;
+            const usize b = (i + 2) % 3;
+
+            setup.edges[i] = PlaneEquation {
+                sy[a] - sy[b],
+                sx[b] - sx[a],
+                sx[a] * sy[b] - sx[b] * sy[a]
+            };
+        }
+
+        const f32 area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sx[2] - sx[0]) * (sy[1] - sy[0]);
+        if (area == 0.0f) return false;
+
+        // With y pointing down, counter-clockwise in NDC gives a negative area
+        if (m_CullBackFaces && area > 0.0f) return false;
+
+        // Flip edges so the inside is positive
+        const f32 sign = area > 0.0f ? 1.0f : -1.0f;
+        setup.topLeft = 0;
+
+        for (usize i = 0; i < 3; ++i) {
+            PlaneEquation& edge = setup.edges[i];
+            edge.a *= sign;
+            edge.b *= sign;
+            edge.c *= sign;
+
+            // Top edge: horizontal with the inside below. Left edge: inside to the right.
+            if (edge.a > 0.0f || (edge.a == 0.0f && edge.b > 0.0f)) {
+                setup.topLeft |= 1u << i;
+            }
+        }
+
+        const f32 invArea = 1.0f / area;
+
+        setup.depth = MakePlane(sx, sy, invArea, sz[0], sz[1], sz[2]);
+        setup.invW = MakePlane(sx, sy, invArea, invW[0], invW[1], invW[2]);
+        setup.red = MakePlane(sx, sy, invArea, v0.r * invW[0], v1.r * invW[1], v2.r * invW[2]);
+        setup.green = MakePlane(sx, sy, invArea, v0.g * invW[0], v1.g * invW[1], v2.g * invW[2]);
+        setup.blue = MakePlane(sx, sy, invArea, v0.b * invW[0], v1.b * invW[1], v2.b * invW[2]);
+
+        for (PlaneEquation& edge : setup.edges) ShiftToPixelCenter(edge);
+        ShiftToPixelCenter(setup.depth);
+        ShiftToPixelCenter(setup.invW);
+        ShiftToPixelCenter(setup.red);
+        ShiftToPixelCenter(setup.green);
+        ShiftToPixelCenter(setup.blue);
+
+        return true;
+    }
+
+    void SoftwareRenderer::Bin()
+    {
+        for (auto& bin : m_Bins) {
+            bin.clear();
+        }
+
+        const u32 tilesX = m_Framebuffer.GetTileCountX();
+
+        for (u32 i = 0; i < m_Setups.size(); ++i) {
+            if (!m_Visible[i]) {
+                ++m_Stats.culled;
+                continue;
+            }
+
+            const TriangleSetup& setup = m_Setups[i];
+            const u32 tileX0 = static_cast<u32>(setup.minX) / Framebuffer::TileSize;
+            const u32 tileY0 = static_cast<u32>(setup.minY) / Framebuffer::TileSize;
+            const u32 tileX1 = static_cast<u32>(setup.maxX) / Framebuffer::TileSize;
+            const u32 tileY1 = static_cast<u32>(setup.maxY) / Framebuffer::TileSize;
+
+            for (u32 ty = tileY0; ty <= tileY1; ++ty) {
+                for (u32 tx = tileX0; tx <= tileX1; ++tx) {
+                    m_Bins[static_cast<usize>(ty) * tilesX + tx].push_back(i);
+                    ++m_Stats.binned;
+                }
+            }
+        }
+    }
+
+    void SoftwareRenderer::RasterizeTile(u32 tile) noexcept
+    {
+        const u32 tilesX = m_Framebuffer.GetTileCountX();
+        const u32 tileX = tile % tilesX;
+        const u32 tileY = tile / tilesX;
+
+        m_Framebuffer.ClearTile(tileX, tileY, m_ClearColor, m_ClearDepth);
+
+        const auto& bin = m_Bins[tile];
+        if (bin.empty()) return;
+
+        const TileTarget target {
+            .color = m_Framebuffer.GetColor(),
+            .depth = m_Framebuffer.GetDepth(),
+            .stride = m_Framebuffer.GetStride(),
+            .minX = static_cast<i32>(tileX * Framebuffer::TileSize),
+            .minY = static_cast<i32>(tileY * Framebuffer::TileSize),
+            .maxX = static_cast<i32>(std::min((tileX + 1) * Framebuffer::TileSize, m_Framebuffer.GetWidth())),
+            .maxY = static_cast<i32>(std::min((tileY + 1) * Framebuffer::TileSize, m_Framebuffer.GetHeight()))
+        };
+
+        for (u32 index : bin) {
+            m_Rasterize(target, m_Setups[index]);
+        }
+    }
+
+}
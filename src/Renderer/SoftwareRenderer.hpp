@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Framebuffer.hpp"
+#include "RasterKernels.hpp"
+#include "Core/WorkerPool.hpp"
+
+namespace Renderer {
+
+    // Clip-space position (Vulkan convention: y up in NDC, depth in [0, 1]) and linear RGB
+    struct Vertex
+    {
+        f32 x, y, z, w;
+        f32 r, g, b;
+    };
+
+    struct RasterStats
+    {
+        u32 submitted = 0;
+        u32 culled = 0;
+        u32 binned = 0;
+
+        f32 setupMs = 0.0f;
+        f32 rasterMs = 0.0f;
+    };
+
+    // Tiled CPU rasterizer. Triangles are set up in parallel, binned into
+    // 64x64 tiles, and each tile is cleared and rasterized by one thread so
+    // no two threads ever write the same pixel.
+    class SoftwareRenderer
+    {
+    public:
+        struct Config
+        {
+            u32 width = 1280;
+            u32 height = 720;
+            u32 threads = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+            std::optional<RasterKernel> kernel;
+            bool cullBackFaces = true;
+        };
+
+    public:
+        SoftwareRenderer(const Config& config);
+
+        void Resize(u32 width, u32 height);
+        void SetKernel(RasterKernel kernel);
+
+        void BeginFrame(u32 clearColor = PackColor(0, 0, 0), f32 clearDepth = 1.0f);
+
+        // Counter-clockwise triangles are front facing. Data is copied, callers may reuse their buffers.
+        void Submit(std::span<const Vertex> vertices, std::span<const u32> indices);
+
+        // Rasterizes everything submitted since BeginFrame, blocking until done
+        void EndFrame();
+
+        [[nodiscard]] inline const Framebuffer& GetFramebuffer() const noexcept { return m_Framebuffer; }
+        [[nodiscard]] inline RasterKernel GetKernel() const noexcept { return m_Kernel; }
+        [[nodiscard]] inline const RasterStats& GetStats() const noexcept { return m_Stats; }
+
+    private:
+        bool SetupTriangle(const Vertex& v0, const Vertex& v1, const Vertex& v2, TriangleSetup& setup) const noexcept;
+        void Bin();
+        void RasterizeTile(u32 tile) noexcept;
+
+    private:
+        static constexpr u32 SetupBatchSize = 1024;
+
+        Framebuffer m_Framebuffer;
+        Core::WorkerPool m_Workers;
+
+        RasterKernel m_Kernel;
+        RasterizeFn m_Rasterize;
+        bool m_CullBackFaces;
+
+        u32 m_ClearColor = 0;
+        f32 m_ClearDepth = 1.0f;
+
+        std::vector<Vertex> m_Vertices;
+        std::vector<u32> m_Indices;
+
+        std::vector<TriangleSetup> m_Setups;
+        std::vector<u8> m_Visible;
+        std::vector<std::vector<u32>> m_Bins;
+
+        RasterStats m_Stats;
+    };
+
+}
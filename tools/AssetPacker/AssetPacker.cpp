@@ -0,0 +1,211 @@
+#include "Core/Assets/AssetPackLayout.hpp"
+#include "Core/Assets/LZ4.hpp"
+
+using namespace Core;
+
+namespace {
+
+    struct PackedAsset
+    {
+        std::string name;
+        std::filesystem::path source;
+        std::vector<std::byte> data;
+        u64 size = 0;
+        bool compressed = false;
+
+        AssetPackEntry entry {};
+    };
+
+    void PrintUsage()
+    {
+        std::fprintf(stderr,
+            "Usage: AssetPacker <input directory> <output pack> [--compress] [--min-saving <percent>] [--align <bytes>]\n"
+            "  --compress    store assets LZ4 compressed when it saves enough\n"
+            "  --min-saving  smallest saving worth compressing for (default: 10)\n"
+            "  --align       blob alignment, a power of two (default: %u)\n",
+            AssetPackDefaultAlignment
+        );
+    }
+
+    std::optional<std::vector<std::byte>> ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) return std::nullopt;
+
+        std::vector<std::byte> data(static_cast<usize>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+        if (!file) return std::nullopt;
+        return data;
+    }
+
+    constexpr u64 AlignUp(u64 value, u64 alignment) noexcept
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    std::filesystem::path input;
+    std::filesystem::path output;
+    bool compress = false;
+    u32 minSaving = 10;
+    u32 alignment = AssetPackDefaultAlignment;
+
+    for (i32 i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+
+        if (arg == "--compress") {
+            compress = true;
+        } else if (arg == "--min-saving" && i + 1 < argc) {
+            minSaving = static_cast<u32>(std::clamp(std::atoi(argv[++i]), 0, 100));
+        } else if (arg == "--align" && i + 1 < argc) {
+            alignment = static_cast<u32>(std::max(std::atoi(argv[++i]), 0));
+            if (!std::has_single_bit(alignment) || alignment > AssetPackDataAlignment) {
+                PrintUsage();
+                return 1;
+            }
+        } else if (!arg.starts_with("--") && input.empty()) {
+            input = arg;
+        } else if (!arg.starts_with("--") && output.empty()) {
+            output = arg;
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (input.empty() || output.empty() || !std::filesystem::is_directory(input)) {
+        PrintUsage();
+        return 1;
+    }
+
+    std::vector<PackedAsset> assets;
+    for (const auto& file : std::filesystem::recursive_directory_iterator(input)) {
+        if (!file.is_regular_file()) continue;
+
+        PackedAsset& asset = assets.emplace_back();
+        asset.source = file.path();
+        asset.name = std::filesystem::relative(file.path(), input).generic_string();
+    }
+
+    // Blobs are laid out in path order so assets from one directory share pages
+    std::ranges::sort(assets, {}, &PackedAsset::name);
+
+    u64 totalSize = 0;
+    u64 totalStored = 0;
+    u32 compressedCount = 0;
+
+    for (PackedAsset& asset : assets) {
+        auto data = ReadFile(asset.source);
+        if (!data) {
+            std::fprintf(stderr, "Failed to read %s\n", asset.source.string().c_str());
+            return 1;
+        }
+
+        asset.size = data->size();
+        asset.data = std::move(*data);
+
+        if (compress && asset.size > 0) {
+            std::vector<std::byte> packed(LZ4::GetMaxCompressedSize(asset.size));
+            const usize packedSize = LZ4::Compress(asset.data, packed);
+
+            if (packedSize > 0 && packedSize * 100 <= asset.size * (100 - minSaving)) {
+                packed.resize(packedSize);
+                asset.data = std::move(packed);
+                asset.compressed = true;
+                ++compressedCount;
+            }
+        }
+
+        totalSize += asset.size;
+        totalStored += asset.data.size();
+    }
+
+    std::string names;
+    for (PackedAsset& asset : assets) {
+        asset.entry.nameOffset = static_cast<u32>(names.size());
+        asset.entry.nameLength = static_cast<u32>(asset.name.size());
+        names += asset.name;
+    }
+
+    AssetPackHeader header {};
+    header.magic = AssetPackMagic;
+    header.version = AssetPackVersion;
+    header.entryCount = static_cast<u32>(assets.size());
+    header.alignment = alignment;
+    header.indexOffset = sizeof(AssetPackHeader);
+    header.namesOffset = header.indexOffset + assets.size() * sizeof(AssetPackEntry);
+    header.namesSize = names.size();
+    header.dataOffset = AlignUp(header.namesOffset + header.namesSize, AssetPackDataAlignment);
+
+    u64 offset = header.dataOffset;
+    for (PackedAsset& asset : assets) {
+        offset = AlignUp(offset, alignment);
+
+        asset.entry.hash = HashAssetPath(asset.name);
+        asset.entry.offset = offset;
+        asset.entry.storedSize = asset.data.size();
+        asset.entry.size = asset.size;
+        asset.entry.flags = asset.compressed ? AssetEntryFlags::LZ4 : AssetEntryFlags::None;
+
+        offset += asset.data.size();
+    }
+    header.dataSize = offset - header.dataOffset;
+
+    std::vector<AssetPackEntry> index;
+    index.reserve(assets.size());
+    for (const PackedAsset& asset : assets) {
+        index.push_back(asset.entry);
+    }
+
+    std::ranges::sort(index, [&](const AssetPackEntry& a, const AssetPackEntry& b) {
+        return a.hash != b.hash ? a.hash < b.hash : a.nameOffset < b.nameOffset;
+    });
+
+    for (usize i = 1; i < index.size(); ++i) {
+        if (index[i].hash == index[i - 1].hash) {
+            std::fprintf(stderr, "Note: hash collision between %.*s and %.*s\n",
+                static_cast<i32>(index[i - 1].nameLength), names.data() + index[i - 1].nameOffset,
+                static_cast<i32>(index[i].nameLength), names.data() + index[i].nameOffset);
+        }
+    }
+
+    std::ofstream file(output, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::fprintf(stderr, "Failed to create %s\n", output.string().c_str());
+        return 1;
+    }
+
+    auto writeAt = [&](u64 position, const void* data, usize size) {
+        static constexpr char Padding[AssetPackDataAlignment] {};
+
+        const u64 current = static_cast<u64>(file.tellp());
+        file.write(Padding, static_cast<std::streamsize>(position - current));
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    };
+
+    writeAt(0, &header, sizeof(header));
+    writeAt(header.indexOffset, index.data(), index.size() * sizeof(AssetPackEntry));
+    writeAt(header.namesOffset, names.data(), names.size());
+    writeAt(header.dataOffset, nullptr, 0);
+
+    for (const PackedAsset& asset : assets) {
+        writeAt(asset.entry.offset, asset.data.data(), asset.data.size());
+    }
+
+    file.close();
+    if (!file) {
+        std::fprintf(stderr, "Failed to write %s\n", output.string().c_str());
+        return 1;
+    }
+
+    std::printf("Packed %zu assets (%u compressed) into %s\n", assets.size(), compressedCount, output.string().c_str());
+    std::printf("  %llu bytes of assets stored in %llu bytes, pack is %llu bytes\n",
+        static_cast<unsigned long long>(totalSize),
+        static_cast<unsigned long long>(totalStored),
+        static_cast<unsigned long long>(offset));
+}
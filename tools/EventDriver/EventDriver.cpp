@@ -0,0 +1,552 @@
+#include "Core/Events/InjectionLayout.hpp"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Core;
+
+namespace {
+
+    std::atomic<bool> s_Interrupted = false;
+
+    void PrintUsage()
+    {
+        std::fprintf(stderr,
+            "Usage: EventDriver [options]\n"
+            "  --segment <name>    shared memory segment name (default: %s)\n"
+            "  --wait <seconds>    how long to wait for the application to create the segment (default: 10)\n"
+            "  --script <file>     send the events in <file> instead of random ones\n"
+            "  --loop              repeat the script until interrupted\n"
+            "  --rate <events/s>   random events per second, 0 for as fast as the ring drains (default: 1000)\n"
+            "  --count <n>         stop after <n> random events\n"
+            "  --duration <s>      stop after <s> seconds\n"
+            "  --seed <n>          random seed (default: time based)\n"
+            "  --size <w> <h>      area random mouse moves stay in (default: 1280 720)\n"
+            "\n"
+            "Script lines are '<delay ms> <event> [args]', # starts a comment. Events:\n"
+            "  close | resize <w> <h> | move <x> <y> | minimize <0|1> | focus <0|1>\n"
+            "  key_press <key> [repeat] | key_release <key> | type <char or codepoint>\n"
+            "  button_press <button> | button_release <button> | mouse_move <x> <y> | scroll <x> <y>\n"
+            "  gamepad_connect <n> | gamepad_disconnect <n>\n"
+            "Keys are GLFW key codes, a letter or digit, or one of space, escape, enter, tab, backspace,\n"
+            "left, right, up, down. Buttons are left, right, middle or 0-5.\n",
+            DefaultInjectionSegment
+        );
+    }
+
+    // The single producer side of the ring
+    class Producer
+    {
+    public:
+        ~Producer()
+        {
+            Detach();
+        }
+
+        bool Attach(const std::string& segment, f64 waitSeconds)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<f64>(waitSeconds);
+            bool announced = false;
+
+            // The application creates the segment and publishes the magic once the header is complete
+            for (;;) {
+                const std::optional<bool> result = TryMap(segment);
+                if (result && *result) break;
+                if (result && !*result) return false;
+
+                if (std::chrono::steady_clock::now() > deadline || s_Interrupted) {
+                    std::fprintf(stderr, "Segment \"%s\" did not appear, is the application running with event injection enabled?\n", segment.c_str());
+                    return false;
+                }
+
+                if (!announced) {
+                    std::fprintf(stderr, "Waiting for segment \"%s\"...\n", segment.c_str());
+                    announced = true;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+
+            // One producer at a time; a claim left by a driver that died is taken over
+            const u32 self = static_cast<u32>(getpid());
+            u32 owner = 0;
+            while (!m_Header->producerPid.compare_exchange_strong(owner, self)) {
+                if (kill(static_cast<pid_t>(owner), 0) == 0 || errno != ESRCH) {
+                    std::fprintf(stderr, "Another driver (pid %u) is attached to the segment\n", owner);
+                    Unmap();
+                    return false;
+                }
+            }
+
+            m_ConsumerPid = m_Header->consumerPid;
+            m_WriteIndex = m_Header->writeIndex.load(std::memory_order_relaxed);
+            return true;
+        }
+
+        void Detach()
+        {
+            if (!m_Header) return;
+
+            u32 self = static_cast<u32>(getpid());
+            m_Header->producerPid.compare_exchange_strong(self, 0);
+            Unmap();
+        }
+
+        // Blocks while the ring is full; false once the application is gone
+        bool Push(const InjectedEvent& event)
+        {
+            if (m_WriteIndex - m_Header->readIndex.load(std::memory_order_acquire) >= m_Capacity) {
+                ++m_Stalls;
+
+                auto lastCheck = std::chrono::steady_clock::now();
+                u32 spins = 0;
+
+                while (m_WriteIndex - m_Header->readIndex.load(std::memory_order_acquire) >= m_Capacity) {
+                    if (s_Interrupted) return false;
+
+                    // The application drains once per frame, a short sleep loses nothing
+                    if (++spins < 64) {
+                        std::this_thread::yield();
+                    } else {
+                        std::this_thread::sleep_for(std::chrono::microseconds(200));
+                    }
+
+                    const auto now = std::chrono::steady_clock::now();
+                    if (now - lastCheck > std::chrono::milliseconds(250)) {
+                        lastCheck = now;
+                        if (!IsConsumerAlive()) return false;
+                    }
+                }
+            }
+
+            m_Records[m_WriteIndex & (m_Capacity - 1)] = event;
+            m_Header->writeIndex.store(++m_WriteIndex, std::memory_order_release);
+
+            return true;
+        }
+
+        [[nodiscard]] bool IsConsumerAlive() const noexcept
+        {
+            // A restarted application resets the segment, which also ends this session
+            return kill(static_cast<pid_t>(m_ConsumerPid), 0) == 0
+                && std::atomic_ref(m_Header->magic).load(std::memory_order_acquire) == InjectionMagic
+                && m_Header->consumerPid == m_ConsumerPid;
+        }
+
+        [[nodiscard]] inline u64 GetStalls() const noexcept { return m_Stalls; }
+        [[nodiscard]] inline u64 GetCapacity() const noexcept { return m_Capacity; }
+
+    private:
+        // nullopt while the segment is missing or not initialized yet, false on a hard error
+        std::optional<bool> TryMap(const std::string& segment)
+        {
+            i32 fd = shm_open(segment.c_str(), O_RDWR, 0);
+            if (fd < 0) return std::nullopt;
+
+            struct stat info {};
+            if (fstat(fd, &info) != 0 || static_cast<usize>(info.st_size) < InjectionHeaderSize) {
+                close(fd);
+                return std::nullopt;
+            }
+
+            const usize size = static_cast<usize>(info.st_size);
+            void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+
+            if (mapping == MAP_FAILED) {
+                std::fprintf(stderr, "Failed to map segment: %s\n", std::strerror(errno));
+                return false;
+            }
+
+            InjectionHeader* header = static_cast<InjectionHeader*>(mapping);
+            if (std::atomic_ref(header->magic).load(std::memory_order_acquire) != InjectionMagic) {
+                munmap(mapping, size);
+                return std::nullopt;
+            }
+
+            if (header->version != InjectionVersion || header->headerSize != InjectionHeaderSize
+                || header->recordSize != sizeof(InjectedEvent) || !std::has_single_bit(header->capacity)
+                || GetInjectionSegmentSize(header->capacity) > size) {
+                std::fprintf(stderr, "Segment layout mismatch (version %u, expected version %u)\n", header->version, InjectionVersion);
+                munmap(mapping, size);
+                return false;
+            }
+
+            m_Mapping = mapping;
+            m_MappingSize = size;
+            m_Header = header;
+            m_Records = reinterpret_cast<InjectedEvent*>(static_cast<std::byte*>(mapping) + InjectionHeaderSize);
+            m_Capacity = header->capacity;
+
+            return true;
+        }
+
+        void Unmap()
+        {
+            if (m_Mapping) munmap(m_Mapping, m_MappingSize);
+
+            m_Mapping = nullptr;
+            m_Header = nullptr;
+            m_Records = nullptr;
+        }
+
+    private:
+        void* m_Mapping = nullptr;
+        usize m_MappingSize = 0;
+
+        InjectionHeader* m_Header = nullptr;
+        InjectedEvent* m_Records = nullptr;
+        u64 m_Capacity = 0;
+        u64 m_WriteIndex = 0;
+        u32 m_ConsumerPid = 0;
+
+        u64 m_Stalls = 0;
+    };
+
+    // Tracks what is held so a run can end with everything released
+    struct HeldState
+    {
+        std::set<KeyCode> keys;
+        std::set<MouseButton> buttons;
+
+        void Track(const CoreEvents& event)
+        {
+            if (auto* e = std::get_if<KeyPressedEvent>(&event)) keys.insert(e->keycode);
+            if (auto* e = std::get_if<KeyReleasedEvent>(&event)) keys.erase(e->keycode);
+            if (auto* e = std::get_if<MouseButtonPressedEvent>(&event)) buttons.insert(e->button);
+            if (auto* e = std::get_if<MouseButtonReleasedEvent>(&event)) buttons.erase(e->button);
+        }
+    };
+
+    std::optional<KeyCode> ParseKey(std::string_view text)
+    {
+        static constexpr std::array<std::pair<std::string_view, KeyCode>, 9> Names { {
+            { "space", KeyCode::Space },
+            { "escape", KeyCode::Escape },
+            { "enter", KeyCode::Enter },
+            { "tab", KeyCode::Tab },
+            { "backspace", KeyCode::Backspace },
+            { "left", KeyCode::Left },
+            { "right", KeyCode::Right },
+            { "up", KeyCode::Up },
+            { "down", KeyCode::Down }
+        } };
+
+        for (const auto& [name, key] : Names) {
+            if (text == name) return key;
+        }
+
+        // GLFW uses the upper-case ASCII value for letters and digits
+        if (text.size() == 1 && std::isalnum(static_cast<unsigned char>(text[0]))) {
+            return static_cast<KeyCode>(std::toupper(static_cast<unsigned char>(text[0])));
+        }
+
+        u32 code = 0;
+        auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), code);
+        if (error != std::errc() || end != text.data() + text.size() || code > static_cast<u32>(KeyCode::Menu)) return std::nullopt;
+
+        return static_cast<KeyCode>(code);
+    }
+
+    std::optional<MouseButton> ParseButton(std::string_view text)
+    {
+        if (text == "left") return MouseButton::Left;
+        if (text == "right") return MouseButton::Right;
+        if (text == "middle") return MouseButton::Middle;
+
+        if (text.size() == 1 && text[0] >= '0' && text[0] <= '5') {
+            return static_cast<MouseButton>(text[0] - '0');
+        }
+
+        return std::nullopt;
+    }
+
+    struct ScriptLine
+    {
+        u32 delayMs;
+        CoreEvents event;
+    };
+
+    std::optional<CoreEvents> ParseEvent(std::string_view name, std::istringstream& args)
+    {
+        std::string first;
+        std::string second;
+        args >> first >> second;
+
+        const auto number = [](const std::string& text) -> std::optional<f64> {
+            char* end = nullptr;
+            const f64 value = std::strtod(text.c_str(), &end);
+            if (text.empty() || *end != '\0') return std::nullopt;
+            return value;
+        };
+
+        const std::optional<f64> a = number(first);
+        const std::optional<f64> b = number(second);
+
+        if (name == "close") return WindowClosedEvent();
+        if (name == "resize" && a && b && *a > 0 && *b > 0) return WindowResizedEvent(static_cast<u32>(*a), static_cast<u32>(*b));
+        if (name == "move" && a && b) return WindowMovedEvent(static_cast<i32>(*a), static_cast<i32>(*b));
+        if (name == "minimize" && a) return WindowMinimizeEvent(*a != 0.0);
+        if (name == "focus" && a) return WindowFocusEvent(*a != 0.0);
+        if (name == "mouse_move" && a && b) return MouseMovedEvent(static_cast<f32>(*a), static_cast<f32>(*b));
+        if (name == "scroll" && a && b) return MouseScrolledEvent(static_cast<f32>(*a), static_cast<f32>(*b));
+        if (name == "gamepad_connect" && a && *a >= 0 && *a < 256) return GamepadConnectedEvent(static_cast<u8>(*a));
+        if (name == "gamepad_disconnect" && a && *a >= 0 && *a < 256) return GamepadDisconnectedEvent(static_cast<u8>(*a));
+
+        if (name == "key_press" || name == "key_release") {
+            const std::optional<KeyCode> key = ParseKey(first);
+            if (!key) return std::nullopt;
+            if (name == "key_press") return KeyPressedEvent(*key, second == "repeat");
+            return KeyReleasedEvent(*key);
+        }
+
+        if (name == "button_press" || name == "button_release") {
+            const std::optional<MouseButton> button = ParseButton(first);
+            if (!button) return std::nullopt;
+            if (name == "button_press") return MouseButtonPressedEvent(*button);
+            return MouseButtonReleasedEvent(*button);
+        }
+
+        if (name == "type") {
+            if (first.size() == 1) return KeyTypedEvent(static_cast<u8>(first[0]));
+            if (a && *a >= 0) return KeyTypedEvent(static_cast<u32>(*a));
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<std::vector<ScriptLine>> LoadScript(const std::filesystem::path& path)
+    {
+        std::ifstream file(path);
+        if (!file) {
+            std::fprintf(stderr, "Failed to open script %s\n", path.string().c_str());
+            return std::nullopt;
+        }
+
+        std::vector<ScriptLine> lines;
+        std::string text;
+
+        for (u32 number = 1; std::getline(file, text); ++number) {
+            if (const usize comment = text.find('#'); comment != std::string::npos) {
+                text.resize(comment);
+            }
+
+            std::istringstream stream(text);
+            u32 delayMs = 0;
+            std::string name;
+
+            if (!(stream >> delayMs)) {
+                if (text.find_first_not_of(" \t\r") == std::string::npos) continue;
+                std::fprintf(stderr, "%s:%u: expected a delay in milliseconds\n", path.string().c_str(), number);
+                return std::nullopt;
+            }
+
+            stream >> name;
+            std::optional<CoreEvents> event = ParseEvent(name, stream);
+            if (!event) {
+                std::fprintf(stderr, "%s:%u: invalid event '%s'\n", path.string().c_str(), number, text.c_str());
+                return std::nullopt;
+            }
+
+            lines.push_back(ScriptLine { delayMs, *event });
+        }
+
+        return lines;
+    }
+
+    // Mostly mouse movement, like real input. Escape, F9 and F12 are bound to
+    // application actions and are never pressed.
+    class RandomStream
+    {
+    public:
+        RandomStream(u64 seed, f32 width, f32 height)
+            : m_Random(seed), m_Width(width), m_Height(height), m_X(width / 2.0f), m_Y(height / 2.0f)
+        {
+            for (u16 key = static_cast<u16>(KeyCode::A); key <= static_cast<u16>(KeyCode::Z); ++key) {
+                m_Keys.push_back(static_cast<KeyCode>(key));
+            }
+            for (u16 key = static_cast<u16>(KeyCode::D0); key <= static_cast<u16>(KeyCode::D9); ++key) {
+                m_Keys.push_back(static_cast<KeyCode>(key));
+            }
+            m_Keys.insert(m_Keys.end(), { KeyCode::Space, KeyCode::Left, KeyCode::Right, KeyCode::Up, KeyCode::Down });
+        }
+
+        CoreEvents Next(const HeldState& held)
+        {
+            const u32 roll = Uniform(100);
+
+            if (roll < 60) {
+                m_X = std::clamp(m_X + static_cast<f32>(Uniform(41)) - 20.0f, 0.0f, m_Width);
+                m_Y = std::clamp(m_Y + static_cast<f32>(Uniform(41)) - 20.0f, 0.0f, m_Height);
+                return MouseMovedEvent(m_X, m_Y);
+            }
+
+            if (roll < 70) {
+                return MouseScrolledEvent(0.0f, Uniform(2) ? 1.0f : -1.0f);
+            }
+
+            if (roll < 85) {
+                const KeyCode key = m_Keys[Uniform(static_cast<u32>(m_Keys.size()))];
+                if (held.keys.contains(key)) return KeyReleasedEvent(key);
+                return KeyPressedEvent(key, false);
+            }
+
+            if (roll < 95) {
+                const MouseButton button = static_cast<MouseButton>(Uniform(3));
+                if (held.buttons.contains(button)) return MouseButtonReleasedEvent(button);
+                return MouseButtonPressedEvent(button);
+            }
+
+            return KeyTypedEvent('a' + Uniform(26));
+        }
+
+    private:
+        u32 Uniform(u32 bound)
+        {
+            return std::uniform_int_distribution<u32>(0, bound - 1)(m_Random);
+        }
+
+    private:
+        std::mt19937_64 m_Random;
+        std::vector<KeyCode> m_Keys;
+
+        f32 m_Width;
+        f32 m_Height;
+        f32 m_X;
+        f32 m_Y;
+    };
+
+}
+
+int main(int argc, char** argv)
+{
+    std::string segment = DefaultInjectionSegment;
+    std::optional<std::filesystem::path> scriptPath;
+    bool loop = false;
+    f64 waitSeconds = 10.0;
+    f64 rate = 1000.0;
+    std::optional<u64> count;
+    std::optional<f64> duration;
+    u64 seed = static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count());
+    f32 width = 1280.0f;
+    f32 height = 720.0f;
+
+    for (i32 i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+
+        if (arg == "--segment" && i + 1 < argc) {
+            segment = argv[++i];
+        } else if (arg == "--wait" && i + 1 < argc) {
+            waitSeconds = std::max(0.0, std::atof(argv[++i]));
+        } else if (arg == "--script" && i + 1 < argc) {
+            scriptPath = argv[++i];
+        } else if (arg == "--loop") {
+            loop = true;
+        } else if (arg == "--rate" && i + 1 < argc) {
+            rate = std::max(0.0, std::atof(argv[++i]));
+        } else if (arg == "--count" && i + 1 < argc) {
+            count = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--duration" && i + 1 < argc) {
+            duration = std::atof(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--size" && i + 2 < argc) {
+            width = static_cast<f32>(std::max(1.0, std::atof(argv[++i])));
+            height = static_cast<f32>(std::max(1.0, std::atof(argv[++i])));
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    std::vector<ScriptLine> script;
+    if (scriptPath) {
+        auto loaded = LoadScript(*scriptPath);
+        if (!loaded) return 1;
+        script = std::move(*loaded);
+
+        if (script.empty()) {
+            std::fprintf(stderr, "Script %s has no events\n", scriptPath->string().c_str());
+            return 1;
+        }
+    }
+
+    signal(SIGINT, [](i32) { s_Interrupted = true; });
+    signal(SIGTERM, [](i32) { s_Interrupted = true; });
+
+    Producer producer;
+    if (!producer.Attach(segment, waitSeconds)) return 1;
+
+    std::printf("Attached to \"%s\" (%llu records)\n", segment.c_str(), static_cast<unsigned long long>(producer.GetCapacity()));
+    if (!scriptPath) {
+        std::printf("Random events, seed %llu\n", static_cast<unsigned long long>(seed));
+    }
+
+    HeldState held;
+    u64 sent = 0;
+    bool consumerGone = false;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto send = [&](const CoreEvents& event) {
+        // Every CoreEvents alternative the driver builds has a wire form
+        if (!producer.Push(*EncodeInjectedEvent(event))) {
+            consumerGone = !s_Interrupted;
+            return false;
+        }
+
+        held.Track(event);
+        ++sent;
+        return true;
+    };
+
+    const auto expired = [&] {
+        return s_Interrupted || (duration && std::chrono::steady_clock::now() - start >= std::chrono::duration<f64>(*duration));
+    };
+
+    if (scriptPath) {
+        auto due = start;
+
+        do {
+            for (const ScriptLine& line : script) {
+                due += std::chrono::milliseconds(line.delayMs);
+                std::this_thread::sleep_until(due);
+
+                if (expired() || !send(line.event)) break;
+            }
+        } while (loop && !expired() && !consumerGone);
+    } else {
+        RandomStream stream(seed, width, height);
+
+        while (!expired() && (!count || sent < *count)) {
+            // Paced against the start time, so sleep granularity does not lower the average rate
+            if (rate > 0.0) {
+                std::this_thread::sleep_until(start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<f64>(static_cast<f64>(sent) / rate)));
+            }
+
+            if (!send(stream.Next(held))) break;
+        }
+    }
+
+    // Leave nothing pressed behind
+    if (!consumerGone) {
+        const HeldState release = held;
+        for (KeyCode key : release.keys) send(KeyReleasedEvent(key));
+        for (MouseButton button : release.buttons) send(MouseButtonReleasedEvent(button));
+    }
+
+    const f64 elapsed = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("Sent %llu events in %.2fs (%.0f events/s), ring full %llu time(s)\n",
+        static_cast<unsigned long long>(sent), elapsed, elapsed > 0.0 ? static_cast<f64>(sent) / elapsed : 0.0,
+        static_cast<unsigned long long>(producer.GetStalls()));
+
+    if (consumerGone) {
+        std::fprintf(stderr, "The application went away\n");
+        return 1;
+    }
+
+    return 0;
+}
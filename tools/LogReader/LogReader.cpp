@@ -0,0 +1,140 @@
+#include "Core/Logging/RingLogLayout.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Core;
+
+namespace {
+
+    void PrintUsage()
+    {
+        std::fprintf(stderr,
+            "Usage: LogReader [path] [--follow]\n"
+            "  path      ring log file (default: logs/Application.ring)\n"
+            "  --follow  keep printing new records as they are written\n"
+        );
+    }
+
+    // Prints records [from, to) that are still present in the ring, returns the next index to read.
+    // writeIndex is claimed before a record is written, so with waitForCommit the range stops at
+    // the first record still being written and the caller retries it.
+    u64 PrintRange(const RingLogRecord* records, u64 capacity, u64 from, u64 to, bool waitForCommit)
+    {
+        if (to - from > capacity) {
+            std::printf("... %llu records overwritten ...\n", static_cast<unsigned long long>(to - from - capacity));
+            from = to - capacity;
+        }
+
+        for (u64 index = from; index < to; ++index) {
+            const RingLogRecord& record = records[index % capacity];
+
+            const u64 sequence = record.sequence.load(std::memory_order_acquire);
+            if (sequence != index + 1) {
+                // Anything other than a newer lap means the record is not committed yet
+                if (waitForCommit && sequence < index + 1) return index;
+                continue;
+            }
+
+            char text[sizeof(record.text)];
+            const usize length = std::min<usize>(record.length, sizeof(text));
+            std::memcpy(text, record.text, length);
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // Drop the record if the writer reclaimed the slot while we copied it
+            if (record.sequence.load(std::memory_order_relaxed) != index + 1) continue;
+
+            std::printf("%.*s\n", static_cast<i32>(length), text);
+        }
+
+        std::fflush(stdout);
+        return to;
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    std::string path = "logs/Application.ring";
+    bool follow = false;
+
+    for (i32 i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+
+        if (arg == "--follow") {
+            follow = true;
+        } else if (!arg.starts_with("--")) {
+            path = arg;
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    i32 fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::fprintf(stderr, "Failed to open \"%s\": %s\n", path.c_str(), std::strerror(errno));
+        return 1;
+    }
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0) {
+        std::fprintf(stderr, "Failed to stat \"%s\": %s\n", path.c_str(), std::strerror(errno));
+        close(fd);
+        return 1;
+    }
+
+    const usize size = static_cast<usize>(info.st_size);
+    if (size < RingLogHeaderSize) {
+        std::fprintf(stderr, "\"%s\" is too small to be a ring log\n", path.c_str());
+        close(fd);
+        return 1;
+    }
+
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        std::fprintf(stderr, "Failed to map \"%s\": %s\n", path.c_str(), std::strerror(errno));
+        return 1;
+    }
+
+    const std::byte* base = static_cast<const std::byte*>(mapping);
+    const RingLogHeader* header = reinterpret_cast<const RingLogHeader*>(base);
+
+    if (header->magic != RingLogMagic || header->version != RingLogVersion
+        || header->headerSize != RingLogHeaderSize || header->recordSize != RingLogRecordSize
+        || GetRingLogFileSize(header->capacity) != size) {
+        std::fprintf(stderr, "\"%s\" has an unsupported layout (magic %08x, version %u)\n", path.c_str(), header->magic, header->version);
+        munmap(mapping, size);
+        return 1;
+    }
+
+    const RingLogRecord* records = reinterpret_cast<const RingLogRecord*>(base + RingLogHeaderSize);
+    const u64 capacity = header->capacity;
+
+    u64 next = PrintRange(records, capacity, 0, header->writeIndex.load(std::memory_order_acquire), follow);
+
+    // A record that stays uncommitted this long belongs to a writer that died mid-write
+    constexpr u32 MaxStalledPolls = 20;
+    u32 stalledPolls = 0;
+
+    while (follow) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        const u64 to = header->writeIndex.load(std::memory_order_acquire);
+        const u64 from = next;
+        next = PrintRange(records, capacity, next, to, true);
+
+        stalledPolls = next == from && next < to ? stalledPolls + 1 : 0;
+        if (stalledPolls >= MaxStalledPolls) {
+            next = PrintRange(records, capacity, next, to, false);
+            stalledPolls = 0;
+        }
+    }
+
+    munmap(mapping, size);
+    return 0;
+}
@@ -0,0 +1,163 @@
+#include "Core/Metrics/MetricsLayout.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Core::Metrics;
+
+namespace {
+
+    void PrintUsage()
+    {
+        std::fprintf(stderr,
+            "Usage: MetricsReader [--segment <name>] [--watch <interval ms>]\n"
+            "  --segment  shared memory segment name (default: %s)\n"
+            "  --watch    keep printing a snapshot every <interval ms>\n",
+            DefaultSegmentName
+        );
+    }
+
+    // Copies the segment under its seqlock, retrying while the writer is publishing
+    bool ReadSnapshot(const SharedLayout* shared, SharedLayout& snapshot)
+    {
+        for (u32 attempt = 0; attempt < 1000; ++attempt) {
+            const u64 before = shared->header.sequence.load(std::memory_order_acquire);
+            if (before & 1) continue;
+
+            std::memcpy(static_cast<void*>(&snapshot), static_cast<const void*>(shared), sizeof(SharedLayout));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (shared->header.sequence.load(std::memory_order_relaxed) == before) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    f64 HistogramPercentile(const SharedMetric& metric, f64 percentile)
+    {
+        if (metric.value == 0) return 0.0;
+
+        const u64 target = static_cast<u64>(std::ceil(percentile * static_cast<f64>(metric.value)));
+        u64 seen = 0;
+
+        for (usize bucket = 0; bucket < HistogramBuckets; ++bucket) {
+            seen += metric.buckets[bucket];
+            if (seen >= target) {
+                // Report the bucket's upper bound
+                return bucket == 0 ? 0.0 : std::ldexp(1.0, static_cast<i32>(bucket)) - 1.0;
+            }
+        }
+
+        return std::ldexp(1.0, static_cast<i32>(HistogramBuckets)) - 1.0;
+    }
+
+    void PrintSnapshot(const SharedLayout& snapshot)
+    {
+        const SharedHeader& header = snapshot.header;
+
+        std::printf("pid %u  publish #%llu  metrics %u\n",
+            header.pid, static_cast<unsigned long long>(header.publishCount), header.metricCount);
+
+        const u32 count = std::min<u32>(header.metricCount, MaxMetrics);
+        for (u32 i = 0; i < count; ++i) {
+            const SharedMetric& metric = snapshot.metrics[i];
+
+            switch (metric.type) {
+                case MetricType::Counter: {
+                    std::printf("  %-32s counter    %llu\n", metric.name, static_cast<unsigned long long>(metric.value));
+                } break;
+                case MetricType::Gauge: {
+                    std::printf("  %-32s gauge      %.3f\n", metric.name, std::bit_cast<f64>(metric.value));
+                } break;
+                case MetricType::Histogram: {
+                    const f64 mean = metric.value ? static_cast<f64>(metric.sum) / static_cast<f64>(metric.value) : 0.0;
+                    std::printf("  %-32s histogram  n=%llu mean=%.1f p50<=%.0f p99<=%.0f\n",
+                        metric.name, static_cast<unsigned long long>(metric.value), mean,
+                        HistogramPercentile(metric, 0.50), HistogramPercentile(metric, 0.99));
+                } break;
+            }
+        }
+
+        std::fflush(stdout);
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    std::string segment = DefaultSegmentName;
+    i64 intervalMs = -1;
+
+    for (i32 i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+
+        if (arg == "--segment" && i + 1 < argc) {
+            segment = argv[++i];
+        } else if (arg == "--watch" && i + 1 < argc) {
+            intervalMs = std::max<i64>(1, std::atoll(argv[++i]));
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    i32 fd = shm_open(segment.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        std::fprintf(stderr, "Failed to open segment \"%s\": %s\n", segment.c_str(), std::strerror(errno));
+        return 1;
+    }
+
+    // Mapping past the end of a smaller segment would fault on the first read
+    struct stat info {};
+    if (fstat(fd, &info) != 0) {
+        std::fprintf(stderr, "Failed to stat segment: %s\n", std::strerror(errno));
+        close(fd);
+        return 1;
+    }
+
+    if (static_cast<usize>(info.st_size) != sizeof(SharedLayout)) {
+        std::fprintf(stderr, "Segment is %lld bytes, expected %zu (layout mismatch or not initialized yet)\n",
+            static_cast<long long>(info.st_size), sizeof(SharedLayout));
+        close(fd);
+        return 1;
+    }
+
+    void* mapping = mmap(nullptr, sizeof(SharedLayout), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        std::fprintf(stderr, "Failed to map segment: %s\n", std::strerror(errno));
+        return 1;
+    }
+
+    const SharedLayout* shared = static_cast<const SharedLayout*>(mapping);
+
+    if (shared->header.magic != LayoutMagic || shared->header.version != LayoutVersion
+        || shared->header.headerSize != sizeof(SharedHeader) || shared->header.metricSize != sizeof(SharedMetric)) {
+        std::fprintf(stderr, "Segment layout mismatch (magic %08x, version %u, expected version %u)\n",
+            shared->header.magic, shared->header.version, LayoutVersion);
+        munmap(mapping, sizeof(SharedLayout));
+        return 1;
+    }
+
+    auto snapshot = std::make_unique<SharedLayout>();
+
+    do {
+        if (ReadSnapshot(shared, *snapshot)) {
+            PrintSnapshot(*snapshot);
+        } else {
+            std::fprintf(stderr, "Timed out waiting for a consistent snapshot\n");
+        }
+
+        if (intervalMs > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+        }
+    } while (intervalMs > 0);
+
+    munmap(mapping, sizeof(SharedLayout));
+    return 0;
+}
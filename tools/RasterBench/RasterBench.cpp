@@ -0,0 +1,228 @@
+#include "Renderer/SoftwareRenderer.hpp"
+
+using namespace Renderer;
+
+namespace {
+
+    struct Mesh
+    {
+        std::vector<std::array<f32, 3>> positions;
+        std::vector<std::array<f32, 3>> colors;
+        std::vector<u32> indices;
+    };
+
+    void PrintUsage()
+    {
+        std::fprintf(stderr,
+            "Usage: RasterBench [--size <w>x<h>] [--frames <n>] [--threads <n>] [--instances <n>]\n"
+            "                   [--kernel scalar|sse2|avx2|all] [--output <file.tga|file.ppm>]\n"
+            "  --size       framebuffer size (default: 1920x1080)\n"
+            "  --frames     measured frames per kernel (default: 200)\n"
+            "  --threads    extra raster threads (default: hardware threads - 1)\n"
+            "  --instances  tori in the scene, about 2300 triangles each (default: 64)\n"
+            "  --kernel     kernel to measure (default: best supported, 'all' compares every supported kernel)\n"
+            "  --output     save the last frame\n"
+        );
+    }
+
+    Mesh MakeTorus(u32 rings, u32 sides, f32 majorRadius, f32 minorRadius)
+    {
+        Mesh mesh;
+
+        for (u32 ring = 0; ring <= rings; ++ring) {
+            const f32 u = static_cast<f32>(ring) / rings * 2.0f * std::numbers::pi_v<f32>;
+
+            for (u32 side = 0; side <= sides; ++side) {
+                const f32 v = static_cast<f32>(side) / sides * 2.0f * std::numbers::pi_v<f32>;
+                const f32 radius = majorRadius + minorRadius * std::cos(v);
+
+                mesh.positions.push_back({ radius * std::cos(u), minorRadius * std::sin(v), radius * std::sin(u) });
+                mesh.colors.push_back({ 0.5f + 0.5f * std::cos(u), 0.5f + 0.5f * std::sin(v), 0.5f + 0.5f * std::sin(u) });
+            }
+        }
+
+        for (u32 ring = 0; ring < rings; ++ring) {
+            for (u32 side = 0; side < sides; ++side) {
+                const u32 a = ring * (sides + 1) + side;
+                const u32 b = a + sides + 1;
+
+                mesh.indices.insert(mesh.indices.end(), { a, a + 1, b, b, a + 1, b + 1 });
+            }
+        }
+
+        return mesh;
+    }
+
+    // Spins every instance, then projects with a 60 degree perspective (Vulkan depth range)
+    void BuildFrame(const Mesh& mesh, u32 instances, f32 time, f32 aspect, std::vector<Vertex>& out)
+    {
+        constexpr f32 Near = 0.1f;
+        constexpr f32 Far = 100.0f;
+        const f32 focal = 1.0f / std::tan(std::numbers::pi_v<f32> / 6.0f);
+
+        const u32 columns = static_cast<u32>(std::ceil(std::sqrt(static_cast<f32>(instances))));
+
+        out.clear();
+        out.reserve(mesh.positions.size() * instances);
+
+        for (u32 instance = 0; instance < instances; ++instance) {
+            const f32 angle = time + instance * 0.37f;
+            const f32 cosY = std::cos(angle), sinY = std::sin(angle);
+            const f32 cosX = std::cos(angle * 0.7f), sinX = std::sin(angle * 0.7f);
+
+            const f32 offsetX = (static_cast<f32>(instance % columns) - (columns - 1) * 0.5f) * 2.2f;
+            const f32 offsetY = (static_cast<f32>(instance / columns) - (columns - 1) * 0.5f) * 2.2f;
+            const f32 offsetZ = -2.0f - columns * 1.9f;
+
+            for (usize i = 0; i < mesh.positions.size(); ++i) {
+                const auto [px, py, pz] = mesh.positions[i];
+
+                const f32 x1 = px * cosY + pz * sinY;
+                const f32 z1 = pz * cosY - px * sinY;
+                const f32 y2 = py * cosX - z1 * sinX;
+                const f32 z2 = py * sinX + z1 * cosX;
+
+                const f32 x = x1 + offsetX;
+                const f32 y = y2 + offsetY;
+                const f32 z = z2 + offsetZ;
+
+                out.push_back(Vertex {
+                    .x = x * focal / aspect,
+                    .y = y * focal,
+                    .z = Far / (Near - Far) * z + Near * Far / (Near - Far),
+                    .w = -z,
+                    .r = mesh.colors[i][0],
+                    .g = mesh.colors[i][1],
+                    .b = mesh.colors[i][2]
+                });
+            }
+        }
+    }
+
+    std::optional<RasterKernel> ParseKernel(std::string_view name)
+    {
+        for (RasterKernel kernel : { RasterKernel::Scalar, RasterKernel::SSE2, RasterKernel::AVX2 }) {
+            if (GetKernelName(kernel) == name) return kernel;
+        }
+        return std::nullopt;
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    // Keep the renderer's startup logging out of the results table
+    spdlog::set_level(spdlog::level::warn);
+
+    SoftwareRenderer::Config config;
+    config.width = 1920;
+    config.height = 1080;
+
+    u32 frames = 200;
+    u32 instances = 64;
+    std::vector<RasterKernel> kernels { GetBestKernel() };
+    std::filesystem::path output;
+
+    for (i32 i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+
+        if (arg == "--size" && i + 1 < argc) {
+            if (std::sscanf(argv[++i], "%ux%u", &config.width, &config.height) != 2 || config.width == 0 || config.height == 0) {
+                PrintUsage();
+                return 1;
+            }
+        } else if (arg == "--frames" && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--threads" && i + 1 < argc) {
+            config.threads = static_cast<u32>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--instances" && i + 1 < argc) {
+            instances = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--kernel" && i + 1 < argc) {
+            std::string_view name = argv[++i];
+            if (name == "all") {
+                kernels.clear();
+                for (RasterKernel kernel : { RasterKernel::Scalar, RasterKernel::SSE2, RasterKernel::AVX2 }) {
+                    if (IsKernelSupported(kernel)) kernels.push_back(kernel);
+                }
+            } else if (auto kernel = ParseKernel(name); kernel && IsKernelSupported(*kernel)) {
+                kernels = { *kernel };
+            } else {
+                std::fprintf(stderr, "Kernel \"%s\" is unknown or not supported on this CPU\n", argv[i]);
+                return 1;
+            }
+        } else if (arg == "--output" && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    const Mesh torus = MakeTorus(48, 24, 0.7f, 0.3f);
+    const f32 aspect = static_cast<f32>(config.width) / static_cast<f32>(config.height);
+    const u32 trianglesPerFrame = static_cast<u32>(torus.indices.size() / 3) * instances;
+
+    std::printf("%ux%u, %u threads, %u triangles per frame, %u frames\n\n",
+        config.width, config.height, config.threads + 1, trianglesPerFrame, frames);
+    std::printf("  %-8s %9s %9s %9s %9s %9s %12s\n", "kernel", "mean ms", "p50 ms", "p99 ms", "setup ms", "raster ms", "Mtri/s");
+
+    std::vector<Vertex> vertices;
+    std::vector<f32> frameTimes;
+
+    for (RasterKernel kernel : kernels) {
+        config.kernel = kernel;
+        SoftwareRenderer renderer(config);
+
+        frameTimes.clear();
+        f64 setupTotal = 0.0;
+        f64 rasterTotal = 0.0;
+
+        // The first frames warm caches and wake the workers
+        constexpr u32 WarmupFrames = 10;
+
+        for (u32 frame = 0; frame < frames + WarmupFrames; ++frame) {
+            // Geometry is rebuilt outside the timed region, it stands in for the application's own work
+            BuildFrame(torus, instances, frame * (1.0f / 60.0f), aspect, vertices);
+
+            const auto start = std::chrono::steady_clock::now();
+
+            renderer.BeginFrame(PackColor(20, 20, 24));
+
+            // Every instance shares the torus index buffer against its own vertex range
+            const usize stride = torus.positions.size();
+            for (u32 instance = 0; instance < instances; ++instance) {
+                renderer.Submit(std::span<const Vertex>(vertices).subspan(instance * stride, stride), torus.indices);
+            }
+
+            renderer.EndFrame();
+
+            const f32 elapsed = std::chrono::duration<f32, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            if (frame >= WarmupFrames) {
+                frameTimes.push_back(elapsed);
+                setupTotal += renderer.GetStats().setupMs;
+                rasterTotal += renderer.GetStats().rasterMs;
+            }
+        }
+
+        std::vector<f32> sorted = frameTimes;
+        std::ranges::sort(sorted);
+
+        const f64 mean = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.0) / frameTimes.size();
+        const f32 p50 = sorted[sorted.size() / 2];
+        const f32 p99 = sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)];
+
+        std::printf("  %-8s %9.3f %9.3f %9.3f %9.3f %9.3f %12.1f\n",
+            GetKernelName(kernel).data(), mean, p50, p99,
+            setupTotal / frameTimes.size(), rasterTotal / frameTimes.size(),
+            trianglesPerFrame / (mean * 1000.0));
+
+        if (!output.empty() && kernel == kernels.back()) {
+            if (auto result = renderer.GetFramebuffer().Save(output); !result) {
+                std::fprintf(stderr, "%s\n", result.error().c_str());
+                return 1;
+            }
+            std::printf("\nSaved last frame to %s\n", output.string().c_str());
+        }
+    }
+}